@@ -94,5 +94,9 @@ if test "$PHP_PDO_CUBRID" != "no"; then
     ifdef([PHP_ADD_EXTENSION_DEP],
     [
         PHP_ADD_EXTENSION_DEP(pdo_cubrid, pdo) 
+        if test "$PHP_MAJOR_VERSION" = "7"; then
+            PHP_ADD_EXTENSION_DEP(pdo_cubrid, date)
+            PHP_ADD_EXTENSION_DEP(pdo_cubrid, json, true)
+        fi
     ])
 fi
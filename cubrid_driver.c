@@ -74,6 +74,7 @@ static const DB_ERROR_INFO db_error[] = {
     {CUBRID_ER_INVALID_CONN_STR, "Invalid connection string"},
 	{CUBRID_ER_EXEC_TIMEOUT, "Exec query timeout"},
 	{CUBRID_ER_INVALID_CURSOR_POS, "Invalid cursor position (forward only)"},
+	{CUBRID_ER_VALUE_OUT_OF_RANGE, "Value out of range"},
 };
 
 /************************************************************************
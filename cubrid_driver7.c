@@ -81,6 +81,7 @@ static const DB_ERROR_INFO db_error[] = {
     {CUBRID_ER_INVALID_CONN_STR, "Invalid connection string"},
 	{CUBRID_ER_EXEC_TIMEOUT, "Exec query timeout"},
 	{CUBRID_ER_INVALID_CURSOR_POS, "Invalid cursor position (forward only)"},
+	{CUBRID_ER_VALUE_OUT_OF_RANGE, "Value out of range"},
 };
 
 /************************************************************************
@@ -93,6 +94,10 @@ static int fetch_a_row(zval *arg, int req_handle, int type TSRMLS_DC);
 static int cubrid_array_destroy(HashTable * ht ZEND_FILE_LINE_DC);
 static int cubrid_add_index_array(zval *arg, zend_ulong index, T_CCI_SET in_set TSRMLS_DC);
 static int cubrid_add_assoc_array(zval *arg, char *key, T_CCI_SET in_set TSRMLS_DC);
+static void cubrid_bit_to_hex(const unsigned char *src, size_t len, char *dest);
+static int cubrid_hex_to_bit(const char *src, size_t len, unsigned char *dest);
+static void cubrid_stmt_cache_entry_dtor(zval *zv);
+static void cubrid_stmt_cache_trim(pdo_cubrid_db_handle *H, long size);
 
 /************************************************************************
 * IMPLEMENTATION OF CUBRID PDO
@@ -212,6 +217,12 @@ static int cubrid_handle_closer(pdo_dbh_t *dbh TSRMLS_DC)
 			}
 		}
 
+		if (H->stmt_cache) {
+			zend_hash_destroy(H->stmt_cache);
+			pefree(H->stmt_cache, dbh->is_persistent);
+			H->stmt_cache = NULL;
+		}
+
 		if (H->conn_handle) {
 			cci_disconnect(H->conn_handle, &error);
 			H->conn_handle = 0;
@@ -258,6 +269,33 @@ static int cubrid_handle_preparer(pdo_dbh_t *dbh, const char *sql, long sql_len,
 		S->cursor_type = PDO_CURSOR_FWDONLY;
 	}
 
+	S->native_types = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_NATIVE_TYPES, H->native_types TSRMLS_CC) ? 1 : 0;
+	S->fetch_size = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_FETCH_SIZE,
+			pdo_attr_lval(driver_options, PDO_ATTR_PREFETCH, 0 TSRMLS_CC) TSRMLS_CC);
+	S->max_rows = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_MAX_ROWS, 0 TSRMLS_CC);
+	S->fetch_dates = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_FETCH_DATES, H->fetch_dates TSRMLS_CC);
+	S->fetch_collections = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_FETCH_COLLECTIONS, 
+			H->fetch_collections TSRMLS_CC) ? 1 : 0;
+	S->scroll_buffer_size = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_SCROLL_BUFFER_SIZE, 
+			H->scroll_buffer_size TSRMLS_CC);
+	S->numeric_mode = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_NUMERIC_MODE, H->numeric_mode TSRMLS_CC);
+	S->bit_binary = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_BIT_BINARY, H->bit_binary TSRMLS_CC) ? 1 : 0;
+	S->fetch_json = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_FETCH_JSON, H->fetch_json TSRMLS_CC) ? 1 : 0;
+	S->enum_mode = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_ENUM_MODE, H->enum_mode TSRMLS_CC);
+	S->dedup_strings = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_DEDUP_STRINGS, 
+			H->dedup_strings TSRMLS_CC) ? 1 : 0;
+	S->lob_inline_size = pdo_attr_lval(driver_options, PDO_CUBRID_ATTR_LOB_INLINE_SIZE, 
+			H->lob_inline_size TSRMLS_CC);
+
+	if (S->fetch_size < CUBRID_FETCH_SIZE_ADAPTIVE || S->max_rows < 0 || S->scroll_buffer_size < 0 ||
+			S->lob_inline_size < 0 ||
+			S->fetch_dates < CUBRID_DATE_STRING || S->fetch_dates > CUBRID_DATE_LAZY ||
+			S->numeric_mode < CUBRID_NUMERIC_STRING || S->numeric_mode > CUBRID_NUMERIC_SCALED ||
+			S->enum_mode < CUBRID_ENUM_STRING || S->enum_mode > CUBRID_ENUM_ORDINAL) {
+		pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+		return 0;
+	}
+
 	stmt->supports_placeholders = PDO_PLACEHOLDER_POSITIONAL;
 	ret = pdo_parse_params(stmt, (char *)sql, sql_len, &nsql, &nsql_len TSRMLS_CC);
 
@@ -269,34 +307,67 @@ static int cubrid_handle_preparer(pdo_dbh_t *dbh, const char *sql, long sql_len,
 		return 0;
 	}
 
-	if ((stmt_handle = cci_prepare(H->conn_handle, (char *)sql, 0, &error)) < 0) {
-		pdo_cubrid_error(dbh, stmt_handle, &error, NULL);
-		if (nsql) {
-			efree(nsql);
+	if (H->stmt_cache_size > 0) {
+		S->cache_sql = estrndup(sql, sql_len);
+		S->cache_sql_len = sql_len;
+	}
+
+	if (S->cache_sql && 
+			(stmt_handle = pdo_cubrid_stmt_cache_get(dbh, sql, sql_len, &S->bind_num, &S->param_info)) > 0) {
+		/* prepared before on this connection, only the settings of the statement are applied again */
+		S->stmt_handle = stmt_handle;
+
+		cci_set_query_timeout(stmt_handle, H->query_timeout > 0 ? H->query_timeout * 1000 : 0);
+		cci_set_max_row(stmt_handle, S->max_rows);
+
+		if (S->fetch_size > 0) {
+			cci_fetch_size(stmt_handle, S->fetch_size);
 		}
 
-		return 0;
-	}
+		if (S->bind_num > 0) {
+			S->l_bind = (short *) safe_emalloc(S->bind_num, sizeof(short), 0);
+			for (i = 0; i < S->bind_num; i++) {
+				S->l_bind[i] = 0;
+			}
+		}
+	} else {
+		if ((stmt_handle = cci_prepare(H->conn_handle, (char *)sql, 0, &error)) < 0) {
+			pdo_cubrid_error(dbh, stmt_handle, &error, NULL);
+			if (nsql) {
+				efree(nsql);
+			}
+
+			return 0;
+		}
        if(H->query_timeout != -1 && H->query_timeout != 0)
        {
            cci_set_query_timeout(stmt_handle,H->query_timeout*1000);
        }
-	S->stmt_handle = stmt_handle;
-	S->bind_num = cci_get_bind_num(stmt_handle);
+		S->stmt_handle = stmt_handle;
+		S->bind_num = cci_get_bind_num(stmt_handle);
 
-	if (S->bind_num > 0) {
-		S->l_bind = (short *) safe_emalloc(S->bind_num, sizeof(short), 0);
-		for (i = 0; i < S->bind_num; i++) {
-			S->l_bind[i] = 0;
+		if (S->fetch_size > 0) {
+			cci_fetch_size(stmt_handle, S->fetch_size);
 		}
 
-		if ((cubrid_retval = cci_get_param_info(stmt_handle, &(S->param_info), &error)) < 0) {
-			if (cubrid_retval != CAS_ER_NOT_IMPLEMENTED) {
-				pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
-				return 0;
+		if (S->max_rows > 0) {
+			cci_set_max_row(stmt_handle, S->max_rows);
+		}
+
+		if (S->bind_num > 0) {
+			S->l_bind = (short *) safe_emalloc(S->bind_num, sizeof(short), 0);
+			for (i = 0; i < S->bind_num; i++) {
+				S->l_bind[i] = 0;
+			}
+
+			if ((cubrid_retval = cci_get_param_info(stmt_handle, &(S->param_info), &error)) < 0) {
+				if (cubrid_retval != CAS_ER_NOT_IMPLEMENTED) {
+					pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
+					return 0;
+				}
 			}
 		}
-    }
+	}
 
 	S->l_prepare = 1;
 
@@ -486,6 +557,81 @@ static int pdo_cubrid_set_attribute(pdo_dbh_t *dbh, long attr, zval *val TSRMLS_
 			return 0;	
 		}
 
+		return 1;
+	case PDO_CUBRID_ATTR_NATIVE_TYPES:
+		H->native_types = zend_is_true(val) ? 1 : 0;
+
+		return 1;
+	case PDO_CUBRID_ATTR_FETCH_DATES:
+		if (zval_get_long(val) < CUBRID_DATE_STRING || zval_get_long(val) > CUBRID_DATE_LAZY) {
+			pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		H->fetch_dates = (int)zval_get_long(val);
+
+		return 1;
+	case PDO_CUBRID_ATTR_FETCH_COLLECTIONS:
+		H->fetch_collections = zend_is_true(val) ? 1 : 0;
+
+		return 1;
+	case PDO_CUBRID_ATTR_SCROLL_BUFFER_SIZE:
+		if (zval_get_long(val) < 0) {
+			pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		H->scroll_buffer_size = (long)zval_get_long(val);
+
+		return 1;
+	case PDO_CUBRID_ATTR_NUMERIC_MODE:
+		if (zval_get_long(val) < CUBRID_NUMERIC_STRING || zval_get_long(val) > CUBRID_NUMERIC_SCALED) {
+			pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		H->numeric_mode = (int)zval_get_long(val);
+
+		return 1;
+	case PDO_CUBRID_ATTR_BIT_BINARY:
+		H->bit_binary = zend_is_true(val) ? 1 : 0;
+
+		return 1;
+	case PDO_CUBRID_ATTR_FETCH_JSON:
+		H->fetch_json = zend_is_true(val) ? 1 : 0;
+
+		return 1;
+	case PDO_CUBRID_ATTR_ENUM_MODE:
+		if (zval_get_long(val) < CUBRID_ENUM_STRING || zval_get_long(val) > CUBRID_ENUM_ORDINAL) {
+			pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		H->enum_mode = (int)zval_get_long(val);
+
+		return 1;
+	case PDO_CUBRID_ATTR_DEDUP_STRINGS:
+		H->dedup_strings = zend_is_true(val) ? 1 : 0;
+
+		return 1;
+	case PDO_CUBRID_ATTR_LOB_INLINE_SIZE:
+		if (zval_get_long(val) < 0) {
+			pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		H->lob_inline_size = (long)zval_get_long(val);
+
+		return 1;
+	case PDO_CUBRID_ATTR_STMT_CACHE_SIZE:
+		if (zval_get_long(val) < 0) {
+			pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		H->stmt_cache_size = (long)zval_get_long(val);
+		cubrid_stmt_cache_trim(H, H->stmt_cache_size);
+
 		return 1;
 	default:
 		break;
@@ -561,6 +707,50 @@ static int pdo_cubrid_get_attribute(pdo_dbh_t *dbh, long attr, zval *return_valu
 
 		ZVAL_LONG(return_value, param_value);
 
+		break;
+	case PDO_CUBRID_ATTR_NATIVE_TYPES:
+		ZVAL_BOOL(return_value, H->native_types);
+
+		break;
+	case PDO_CUBRID_ATTR_FETCH_DATES:
+		ZVAL_LONG(return_value, H->fetch_dates);
+
+		break;
+	case PDO_CUBRID_ATTR_FETCH_COLLECTIONS:
+		ZVAL_BOOL(return_value, H->fetch_collections);
+
+		break;
+	case PDO_CUBRID_ATTR_SCROLL_BUFFER_SIZE:
+		ZVAL_LONG(return_value, H->scroll_buffer_size);
+
+		break;
+	case PDO_CUBRID_ATTR_NUMERIC_MODE:
+		ZVAL_LONG(return_value, H->numeric_mode);
+
+		break;
+	case PDO_CUBRID_ATTR_BIT_BINARY:
+		ZVAL_BOOL(return_value, H->bit_binary);
+
+		break;
+	case PDO_CUBRID_ATTR_FETCH_JSON:
+		ZVAL_BOOL(return_value, H->fetch_json);
+
+		break;
+	case PDO_CUBRID_ATTR_ENUM_MODE:
+		ZVAL_LONG(return_value, H->enum_mode);
+
+		break;
+	case PDO_CUBRID_ATTR_DEDUP_STRINGS:
+		ZVAL_BOOL(return_value, H->dedup_strings);
+
+		break;
+	case PDO_CUBRID_ATTR_LOB_INLINE_SIZE:
+		ZVAL_LONG(return_value, H->lob_inline_size);
+
+		break;
+	case PDO_CUBRID_ATTR_STMT_CACHE_SIZE:
+		ZVAL_LONG(return_value, H->stmt_cache_size);
+
 		break;
 	default:
 		return 0;
@@ -726,8 +916,157 @@ ERR_CUBRID_SCHEMA:
     RETURN_FALSE;
 }
 
+/* Hex text of a BIT/VARBIT value, as CCI_A_TYPE_STR returns it */
+static PHP_METHOD(PDO, cubrid_bit_encode)
+{
+	pdo_dbh_t *dbh;
+	zend_string *bits;
+	zend_string *hex;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "S", &bits) == FAILURE) {
+		return;
+	}
+
+	dbh = Z_PDO_DBH_P(getThis() TSRMLS_CC);
+	PDO_CONSTRUCT_CHECK;
+
+	hex = zend_string_safe_alloc(ZSTR_LEN(bits), 2, 0, 0);
+	cubrid_bit_to_hex((const unsigned char *)ZSTR_VAL(bits), ZSTR_LEN(bits), ZSTR_VAL(hex));
+	ZSTR_VAL(hex)[ZSTR_LEN(hex)] = '\0';
+
+	RETURN_NEW_STR(hex);
+}
+
+static PHP_METHOD(PDO, cubrid_bit_decode)
+{
+	pdo_dbh_t *dbh;
+	zend_string *hex;
+	zend_string *bits;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "S", &hex) == FAILURE) {
+		return;
+	}
+
+	dbh = Z_PDO_DBH_P(getThis() TSRMLS_CC);
+	PDO_CONSTRUCT_CHECK;
+
+	/* an odd digit count is the high nibble of the last byte */
+	bits = zend_string_alloc((ZSTR_LEN(hex) + 1) / 2, 0);
+
+	if (cubrid_hex_to_bit(ZSTR_VAL(hex), ZSTR_LEN(hex), (unsigned char *)ZSTR_VAL(bits)) == FAILURE) {
+		zend_string_free(bits);
+		pdo_cubrid_error(dbh, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+		RETURN_FALSE;
+	}
+
+	ZSTR_VAL(bits)[ZSTR_LEN(bits)] = '\0';
+
+	RETURN_NEW_STR(bits);
+}
+
+/* Run a list of SQL statements in a single cci_execute_batch request. Returns the affected row count
+ * of each statement, false for a statement that failed; the code and message of each failure are
+ * stored in errors under the index of the statement. */
+static PHP_METHOD(PDO, cubrid_exec_batch)
+{
+	pdo_dbh_t *dbh;
+	pdo_cubrid_db_handle *H;
+
+	zval *sqls, *errors = NULL, *sql;
+	zval err;
+	zend_string **strs = NULL;
+	char **sql_stmts = NULL;
+	T_CCI_QUERY_RESULT *qr = NULL;
+	T_CCI_ERROR error;
+
+	int sql_count = 0, res_count = 0, result;
+	int i = 0;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "a|z", &sqls, &errors) == FAILURE) {
+		return;
+	}
+
+	dbh = Z_PDO_DBH_P(getThis() TSRMLS_CC);
+	PDO_CONSTRUCT_CHECK;
+
+	H = (pdo_cubrid_db_handle *)dbh->driver_data;
+
+	if (errors) {
+		ZVAL_DEREF(errors);
+		zval_ptr_dtor(errors);
+		array_init(errors);
+	}
+
+	sql_count = zend_hash_num_elements(Z_ARRVAL_P(sqls));
+	if (sql_count == 0) {
+		array_init(return_value);
+		return;
+	}
+
+	strs = (zend_string **) safe_emalloc(sql_count, sizeof(zend_string *), 0);
+	sql_stmts = (char **) safe_emalloc(sql_count, sizeof(char *), 0);
+
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(sqls), sql) {
+		strs[i] = zval_get_string(sql);
+		sql_stmts[i] = ZSTR_VAL(strs[i]);
+		i++;
+	} ZEND_HASH_FOREACH_END();
+
+	if ((res_count = cci_execute_batch(H->conn_handle, sql_count, sql_stmts, &qr, &error)) < 0) {
+		pdo_cubrid_error(dbh, res_count, &error, NULL);
+		goto ERR_CUBRID_EXEC_BATCH;
+	}
+
+	array_init_size(return_value, res_count);
+
+	for (i = 1; i <= res_count; i++) {
+		result = CCI_QUERY_RESULT_RESULT(qr, i);
+
+		if (result < 0) {
+			add_next_index_bool(return_value, 0);
+
+			if (errors) {
+				array_init(&err);
+				add_assoc_long(&err, "code", CCI_QUERY_RESULT_ERR_NO(qr, i));
+				add_assoc_string(&err, "message", CCI_QUERY_RESULT_ERR_MSG(qr, i) ? 
+						CCI_QUERY_RESULT_ERR_MSG(qr, i) : "");
+				add_index_zval(errors, i - 1, &err);
+			}
+		} else {
+			add_next_index_long(return_value, result);
+		}
+	}
+
+	cci_query_result_free(qr, res_count);
+
+	for (i = 0; i < sql_count; i++) {
+		zend_string_release(strs[i]);
+	}
+	efree(strs);
+	efree(sql_stmts);
+
+	return;
+
+ERR_CUBRID_EXEC_BATCH:
+	for (i = 0; i < sql_count; i++) {
+		zend_string_release(strs[i]);
+	}
+	efree(strs);
+	efree(sql_stmts);
+
+	RETURN_FALSE;
+}
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_cubrid_exec_batch, 0, 0, 1)
+	ZEND_ARG_ARRAY_INFO(0, sqls, 0)
+	ZEND_ARG_INFO(1, errors)
+ZEND_END_ARG_INFO()
+
 static const zend_function_entry dbh_methods[] = {
 	PHP_ME(PDO, cubrid_schema, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDO, cubrid_bit_encode, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDO, cubrid_bit_decode, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDO, cubrid_exec_batch, arginfo_cubrid_exec_batch, ZEND_ACC_PUBLIC)
 	{NULL, NULL, NULL}
 };
 
@@ -736,6 +1075,8 @@ static const zend_function_entry *pdo_cubrid_get_driver_methods(pdo_dbh_t *dbh,
 	switch (kind) {
 		case PDO_DBH_DRIVER_METHOD_KIND_DBH:
 			return dbh_methods;
+		case PDO_DBH_DRIVER_METHOD_KIND_STMT:
+			return cubrid_stmt_driver_methods;
 		default:
 			return NULL;
 	}
@@ -1073,6 +1414,82 @@ static int cubrid_add_index_array(zval *arg, zend_ulong index, T_CCI_SET in_set
     return 0;
 }
 
+/* Two output characters per table lookup, eight input bytes per round */
+static void cubrid_bit_to_hex(const unsigned char *src, size_t len, char *dest)
+{
+	/* the two hex digits of every byte value, byte b at offset b * 2 */
+	static const char hex_pairs[] =
+		"000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"
+		"202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"
+		"404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F"
+		"606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F"
+		"808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F"
+		"A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+		"C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+		"E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+	size_t i = 0;
+
+	for (; i + 8 <= len; i += 8, dest += 16) {
+		memcpy(dest, &hex_pairs[src[i] * 2], 2);
+		memcpy(dest + 2, &hex_pairs[src[i + 1] * 2], 2);
+		memcpy(dest + 4, &hex_pairs[src[i + 2] * 2], 2);
+		memcpy(dest + 6, &hex_pairs[src[i + 3] * 2], 2);
+		memcpy(dest + 8, &hex_pairs[src[i + 4] * 2], 2);
+		memcpy(dest + 10, &hex_pairs[src[i + 5] * 2], 2);
+		memcpy(dest + 12, &hex_pairs[src[i + 6] * 2], 2);
+		memcpy(dest + 14, &hex_pairs[src[i + 7] * 2], 2);
+	}
+
+	for (; i < len; i++, dest += 2) {
+		memcpy(dest, &hex_pairs[src[i] * 2], 2);
+	}
+}
+
+static int cubrid_hex_to_bit(const char *src, size_t len, unsigned char *dest)
+{
+	/* value of a hex digit character, -1 for anything else */
+	static const signed char nibbles[256] = {
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+		-1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+	};
+
+	size_t i;
+	int hi, lo;
+
+	for (i = 0; i + 1 < len; i += 2) {
+		hi = nibbles[(unsigned char)src[i]];
+		lo = nibbles[(unsigned char)src[i + 1]];
+		if ((hi | lo) < 0) {
+			return FAILURE;
+		}
+		*dest++ = (unsigned char)((hi << 4) | lo);
+	}
+
+	if (i < len) {
+		if ((hi = nibbles[(unsigned char)src[i]]) < 0) {
+			return FAILURE;
+		}
+		*dest = (unsigned char)(hi << 4);
+	}
+
+	return SUCCESS;
+}
+
 static int cubrid_add_assoc_array(zval *arg, char *key, T_CCI_SET in_set TSRMLS_DC)
 {
     zval tmp_zval;
@@ -1106,6 +1523,99 @@ static int cubrid_add_assoc_array(zval *arg, char *key, T_CCI_SET in_set TSRMLS_
     return 0;
 }
 
+/* PDO_CUBRID_ATTR_STMT_CACHE_SIZE: a statement that is destroyed hands its prepared request handle
+ * to the connection instead of closing it, and the next prepare of the same SQL text takes it back
+ * without a round trip. A handle is in use by one statement at a time, so it leaves the cache while
+ * checked out. The table is in insertion order, which makes its first entry the least recently used.
+ * It is allocated like the connection, so with persistent connections it outlives the request. */
+int pdo_cubrid_stmt_cache_get(pdo_dbh_t *dbh, const char *sql, size_t sql_len, 
+		int *bind_num, T_CCI_PARAM_INFO **param_info)
+{
+	pdo_cubrid_db_handle *H = (pdo_cubrid_db_handle *)dbh->driver_data;
+	pdo_cubrid_stmt_cache_entry *entry;
+	int stmt_handle;
+
+	if (!H || !H->stmt_cache || !(entry = zend_hash_str_find_ptr(H->stmt_cache, sql, sql_len))) {
+		return 0;
+	}
+
+	stmt_handle = entry->stmt_handle;
+	*bind_num = entry->bind_num;
+	*param_info = entry->param_info;
+
+	/* checked out, the entry dtor must not close the handle */
+	entry->stmt_handle = 0;
+	entry->param_info = NULL;
+	zend_hash_str_del(H->stmt_cache, sql, sql_len);
+
+	return stmt_handle;
+}
+
+/* Returns 1 when the cache took the handle and param_info over */
+int pdo_cubrid_stmt_cache_put(pdo_dbh_t *dbh, const char *sql, size_t sql_len, 
+		int stmt_handle, int bind_num, T_CCI_PARAM_INFO *param_info)
+{
+	pdo_cubrid_db_handle *H = (pdo_cubrid_db_handle *)dbh->driver_data;
+	pdo_cubrid_stmt_cache_entry *entry;
+
+	if (!H || H->stmt_cache_size <= 0 || stmt_handle <= 0) {
+		return 0;
+	}
+
+	if (!H->stmt_cache) {
+		H->stmt_cache = (HashTable *) pemalloc(sizeof(HashTable), dbh->is_persistent);
+		zend_hash_init(H->stmt_cache, 8, NULL, cubrid_stmt_cache_entry_dtor, dbh->is_persistent);
+	}
+
+	/* another statement of the same SQL was returned first */
+	if (zend_hash_str_exists(H->stmt_cache, sql, sql_len)) {
+		return 0;
+	}
+
+	entry = (pdo_cubrid_stmt_cache_entry *) pemalloc(sizeof(pdo_cubrid_stmt_cache_entry), dbh->is_persistent);
+	entry->stmt_handle = stmt_handle;
+	entry->bind_num = bind_num;
+	entry->param_info = param_info;
+	entry->persistent = dbh->is_persistent;
+
+	zend_hash_str_add_ptr(H->stmt_cache, sql, sql_len, entry);
+	cubrid_stmt_cache_trim(H, H->stmt_cache_size);
+
+	return 1;
+}
+
+static void cubrid_stmt_cache_entry_dtor(zval *zv)
+{
+	pdo_cubrid_stmt_cache_entry *entry = (pdo_cubrid_stmt_cache_entry *)Z_PTR_P(zv);
+
+	if (entry->stmt_handle > 0) {
+		cci_close_req_handle(entry->stmt_handle);
+	}
+
+	if (entry->param_info) {
+		cci_param_info_free(entry->param_info);
+	}
+
+	pefree(entry, entry->persistent);
+}
+
+/* Close the least recently used handles until at most size are left */
+static void cubrid_stmt_cache_trim(pdo_cubrid_db_handle *H, long size)
+{
+	Bucket *p;
+
+	if (!H->stmt_cache) {
+		return;
+	}
+
+	while (zend_hash_num_elements(H->stmt_cache) > (uint32_t)size) {
+		ZEND_HASH_FOREACH_BUCKET(H->stmt_cache, p) {
+			zend_hash_del_bucket(H->stmt_cache, p);
+			break;
+		} ZEND_HASH_FOREACH_END();
+	}
+}
+
 /*
  * Local variables:
  * tab-width: 4
@@ -27,10 +27,15 @@
 #include "php.h"
 #include "php_ini.h"
 #include "ext/standard/info.h"
+#include "ext/date/php_date.h"
+#ifdef HAVE_JSON
+#include "ext/json/php_json.h"
+#endif
 #include "ext/pdo/php_pdo.h"
 #include "ext/pdo/php_pdo_driver.h"
 
 #include "zend_exceptions.h"
+#include "zend_interfaces.h"
 
 /************************************************************************
 * OTHER IMPORTED HEADER FILES
@@ -47,6 +52,66 @@
 
 #define CUBRID_LOB_READ_BUF_SIZE    8192
 
+/* Bounds of the network fetch size in CUBRID_FETCH_SIZE_ADAPTIVE mode */
+#define CUBRID_FETCH_SIZE_DEFAULT   100
+#define CUBRID_FETCH_SIZE_MAX       10000
+#define CUBRID_FETCH_BUF_SIZE       (1024 * 1024)
+#define CUBRID_FETCH_COL_WIDTH_MAX  4096
+
+/* Settings the cached column description depends on */
+#define CUBRID_COL_DESC_FLAGS(S, dbh) \
+	((S)->native_types | ((dbh)->stringify << 1) | ((S)->fetch_dates << 2) | \
+	 ((S)->fetch_collections << 4) | ((S)->numeric_mode << 5) | ((S)->fetch_json << 7) | \
+	 ((S)->enum_mode << 8) | ((S)->dedup_strings << 9) | (((S)->lob_inline_size > 0) << 10) | \
+	 (CUBRID_SCROLL_BUFFERED(S) << 11))
+
+/* State of the client-side scroll buffer of the current result */
+#define CUBRID_SCROLL_NONE          0	/* not tried yet */
+#define CUBRID_SCROLL_LOADED        1	/* every row is served from S->scroll_rows */
+#define CUBRID_SCROLL_UNBUFFERED    2	/* over the memory ceiling or not bufferable, use the CCI cursor */
+
+#define CUBRID_SCROLL_INITIAL_ROWS  64
+
+/* Whether the next execute tries to load the scroll buffer */
+#define CUBRID_SCROLL_BUFFERED(S) \
+	((S)->cursor_type == PDO_CURSOR_SCROLL && (S)->scroll_buffer_size > 0)
+
+/* Declared length from which a scroll buffered string column hands PDO a reference
+ * to the stored zend_string instead of raw bytes that PDO copies on every read */
+#define CUBRID_LARGE_STRING_PRECISION   8192
+
+/* PDO_CUBRID_ATTR_DEDUP_STRINGS: values longer than this are never shared, a column
+ * with more distinct values or with fewer repeats than one in two over the sample stops sharing */
+#define CUBRID_DEDUP_MAX_LEN		256
+#define CUBRID_DEDUP_MAX_VALUES		1024
+#define CUBRID_DEDUP_SAMPLE			4096
+
+/* ext/json is optional, without it JSON columns are fetched as strings */
+#ifdef HAVE_JSON
+#define CUBRID_JSON_LOADED() zend_hash_str_exists(&module_registry, "json", sizeof("json") - 1)
+#else
+#define CUBRID_JSON_LOADED() 0
+#endif
+
+#define CUBRID_IS_STRING_TYPE(t) \
+	((t) == CCI_U_TYPE_CHAR || (t) == CCI_U_TYPE_STRING || \
+	 (t) == CCI_U_TYPE_NCHAR || (t) == CCI_U_TYPE_VARNCHAR)
+
+#define CUBRID_IS_DATE_TYPE(t) \
+	((t) == CCI_U_TYPE_DATE || (t) == CCI_U_TYPE_TIME || \
+	 (t) == CCI_U_TYPE_TIMESTAMP || (t) == CCI_U_TYPE_DATETIME)
+
+#define CUBRID_IS_DATE_TZ_TYPE(t) \
+	((t) == CCI_U_TYPE_TIMESTAMPTZ || (t) == CCI_U_TYPE_TIMESTAMPLTZ || \
+	 (t) == CCI_U_TYPE_DATETIMETZ || (t) == CCI_U_TYPE_DATETIMELTZ)
+
+#define CUBRID_IS_INTEGER_TYPE(t) \
+	((t) == CCI_U_TYPE_INT || (t) == CCI_U_TYPE_SHORT || (t) == CCI_U_TYPE_BIGINT)
+
+#define CUBRID_IS_NUMBER_TYPE(t) \
+	(CUBRID_IS_INTEGER_TYPE(t) || (t) == CCI_U_TYPE_FLOAT || (t) == CCI_U_TYPE_DOUBLE || \
+	 (t) == CCI_U_TYPE_NUMERIC || (t) == CCI_U_TYPE_MONETARY)
+
 /* Maximum length for the Cubrid data types */
 #define MAX_CUBRID_CHAR_LEN   1073741823
 #define MAX_LEN_INTEGER	      (10 + 1)
@@ -59,11 +124,15 @@
 #define MAX_LEN_TIME	      8
 #define MAX_LEN_TIMESTAMP     23
 #define MAX_LEN_DATETIME      MAX_LEN_TIMESTAMP
+#define MAX_LEN_TZ            64
+#define MAX_LEN_TIMESTAMPTZ   (MAX_LEN_TIMESTAMP + 1 + MAX_LEN_TZ)
+#define MAX_LEN_DATETIMETZ    (MAX_LEN_DATETIME + 1 + MAX_LEN_TZ)
 #define MAX_LEN_OBJECT	      MAX_CUBRID_CHAR_LEN
 #define MAX_LEN_SET	          MAX_CUBRID_CHAR_LEN
 #define MAX_LEN_MULTISET      MAX_CUBRID_CHAR_LEN
 #define MAX_LEN_SEQUENCE      MAX_CUBRID_CHAR_LEN
 #define MAX_LEN_LOB			  MAX_CUBRID_CHAR_LEN
+#define MAX_LEN_JSON		  MAX_CUBRID_CHAR_LEN
 
 /************************************************************************
 * PRIVATE TYPE DEFINITIONS
@@ -76,6 +145,27 @@ typedef struct
     int len;
 } DB_TYPE_INFO;
 
+/* Row value of a DATE/TIME/DATETIME/TIMESTAMP column in CUBRID_DATE_LAZY mode */
+typedef struct
+{
+	T_CCI_DATE date;
+	T_CCI_U_TYPE type;
+	char tz[MAX_LEN_TZ];	/* zone of the *TZ/*LTZ types, empty otherwise */
+	zval datetime;			/* DateTimeImmutable, built on first use */
+	zend_object std;
+} cubrid_lazy_date_obj;
+
+/* Row returned by PDOStatement::cubrid_fetch_lazy, columns are decoded when first read */
+typedef struct
+{
+	zval stmt;				/* the PDOStatement the row comes from */
+	long result_seq;		/* S->result_seq of the result the row belongs to */
+	long row;				/* 1-based row in the result, see S->cursor_row */
+	int col_count;
+	zval *values;			/* IS_UNDEF until read */
+	zend_object std;
+} cubrid_lazy_row_obj;
+
 /* Define Cubrid supported date types */
 static const DB_TYPE_INFO db_type_info[] = {
     {"NULL", CCI_U_TYPE_NULL, 0},
@@ -103,6 +193,10 @@ static const DB_TYPE_INFO db_type_info[] = {
     {"TIME", CCI_U_TYPE_TIME, MAX_LEN_TIME},
     {"DATETIME", CCI_U_TYPE_DATETIME, MAX_LEN_DATETIME},
     {"TIMESTAMP", CCI_U_TYPE_TIMESTAMP, MAX_LEN_TIMESTAMP},
+    {"TIMESTAMPTZ", CCI_U_TYPE_TIMESTAMPTZ, MAX_LEN_TIMESTAMPTZ},
+    {"TIMESTAMPLTZ", CCI_U_TYPE_TIMESTAMPLTZ, MAX_LEN_TIMESTAMPTZ},
+    {"DATETIMETZ", CCI_U_TYPE_DATETIMETZ, MAX_LEN_DATETIMETZ},
+    {"DATETIMELTZ", CCI_U_TYPE_DATETIMELTZ, MAX_LEN_DATETIMETZ},
 
     {"SET", CCI_U_TYPE_SET, MAX_LEN_SET},
     {"MULTISET", CCI_U_TYPE_MULTISET, MAX_LEN_MULTISET},
@@ -113,6 +207,7 @@ static const DB_TYPE_INFO db_type_info[] = {
 	{"BLOB", CCI_U_TYPE_BLOB, MAX_LEN_LOB},
 	{"CLOB", CCI_U_TYPE_CLOB, MAX_LEN_LOB},
 	{"ENUM", CCI_U_TYPE_ENUM, -1},
+	{"JSON", CCI_U_TYPE_JSON, MAX_LEN_JSON},
 };
 
 /************************************************************************
@@ -121,7 +216,58 @@ static const DB_TYPE_INFO db_type_info[] = {
 
 static int get_cubrid_u_type_by_name(const char *type_name);
 static int get_cubrid_u_type_len(T_CCI_U_TYPE type);
+static int get_cubrid_native_param_type(T_CCI_U_TYPE type);
+static int cubrid_build_col_desc(pdo_stmt_t *stmt TSRMLS_DC);
+static void cubrid_build_decoders(pdo_stmt_t *stmt TSRMLS_DC);
+static void cubrid_free_decoders(pdo_cubrid_stmt *S);
+static int cubrid_decode_none(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_str(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_bit(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_lob(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_int(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_bigint(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_numeric_scaled(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_enum_ordinal(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+#if PDO_DRIVER_API >= 20080721
+static int cubrid_decode_collection(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_json(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_enum_label(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_string_zval(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_date(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_date_tz(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_double(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static int cubrid_decode_lob_inline(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+#endif
+static int cubrid_col_desc_matches(pdo_cubrid_stmt *S, T_CCI_COL_INFO *col_info, int col_count);
+static void cubrid_free_col_desc(pdo_cubrid_stmt *S);
+static int cubrid_estimate_row_width(pdo_cubrid_stmt *S);
+static int cubrid_stmt_col_to_zval(pdo_stmt_t *stmt, int colno, zval *dest TSRMLS_DC);
+static int cubrid_stmt_col_to_bound(pdo_stmt_t *stmt, int colno, zval *dest, int type TSRMLS_DC);
+static int cubrid_stmt_fetch_next(pdo_stmt_t *stmt TSRMLS_DC);
+static int cubrid_stmt_numeric_to_zval(pdo_stmt_t *stmt, int colno, T_CCI_U_TYPE type, zval *dest TSRMLS_DC);
+static int cubrid_stmt_set_to_zval(pdo_stmt_t *stmt, int colno, zval *dest TSRMLS_DC);
+static int cubrid_numeric_to_scaled(const char *str, int scale, zend_long *result);
+static zend_string *cubrid_dedup_string(pdo_cubrid_stmt *S, int colno, const char *str, size_t len);
+static void cubrid_dedup_reset(pdo_cubrid_col_desc *desc);
+static zend_string *cubrid_enum_shared_label(pdo_cubrid_col_desc *desc, const char *label, size_t len);
+static int cubrid_enum_ordinal(pdo_stmt_t *stmt, int colno, const char *label, size_t len, zend_long *ordinal TSRMLS_DC);
+static int cubrid_enum_load_labels(pdo_stmt_t *stmt, int colno, T_CCI_ERROR *error TSRMLS_DC);
+static int cubrid_enum_parse_labels(const char *type, zval *labels);
+static int cubrid_scroll_buffer_load(pdo_stmt_t *stmt TSRMLS_DC);
+static int cubrid_scroll_buffer_fetch(pdo_cubrid_stmt *S, enum pdo_fetch_orientation ori, long offset);
+static int cubrid_scroll_buffer_get_col_data(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+static void cubrid_scroll_buffer_free(pdo_cubrid_stmt *S);
+static void cubrid_free_zvals(zval *vals, long count);
+static size_t cubrid_zval_size(zval *zv);
+static void cubrid_adapt_fetch_size(pdo_cubrid_stmt *S, enum pdo_fetch_orientation ori, long abs_offset);
 static int type2str(T_CCI_COL_INFO * column_info, char *type_name, int type_name_len);
+static void cubrid_date_to_zval(T_CCI_DATE *date, const char *tz, T_CCI_U_TYPE type, int mode, zval *dest TSRMLS_DC);
+static void cubrid_date_to_datetime(T_CCI_DATE *date, const char *tz, T_CCI_U_TYPE type, zval *dest TSRMLS_DC);
+static int cubrid_date_to_str(T_CCI_DATE *date, const char *tz, T_CCI_U_TYPE type, char *buf, int buf_len);
+
+static void cubrid_lazy_row_init(zval *dest, pdo_stmt_t *stmt TSRMLS_DC);
+
+static int cubrid_stmt_cache_release(pdo_stmt_t *stmt TSRMLS_DC);
 
 static php_stream *cubrid_create_lob_stream(pdo_stmt_t *stmt, T_CCI_LOB lob, T_CCI_U_TYPE type TSRMLS_DC);
 
@@ -153,6 +299,12 @@ static int cubrid_stmt_dtor(pdo_stmt_t *stmt TSRMLS_DC)
 			}
 		}
 
+		if (cubrid_stmt_cache_release(stmt TSRMLS_CC)) {
+			/* the handle and its parameter info now belong to the statement cache */
+			S->param_info = NULL;
+			S->stmt_handle = 0;
+		}
+
 		if (S->bind_num > 0) {
 			if (S->l_bind) {
 				efree(S->l_bind);
@@ -173,6 +325,15 @@ static int cubrid_stmt_dtor(pdo_stmt_t *stmt TSRMLS_DC)
 
 		S->stmt_handle = 0;
 	}
+
+	if (S->cache_sql) {
+		efree(S->cache_sql);
+		S->cache_sql = NULL;
+	}
+
+	cubrid_free_col_desc(S);
+	cubrid_scroll_buffer_free(S);
+	cubrid_free_decoders(S);
 	
 	efree(S);
 	stmt->driver_data = NULL;
@@ -180,6 +341,25 @@ static int cubrid_stmt_dtor(pdo_stmt_t *stmt TSRMLS_DC)
 	return 1;
 }
 
+/* Hand the request handle to the connection's statement cache if it can serve another prepare of
+ * the same SQL: its result is closed and it carries no per-statement fetch settings */
+static int cubrid_stmt_cache_release(pdo_stmt_t *stmt TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	T_CCI_ERROR error;
+
+	if (!S->cache_sql || !S->H || S->array_bound || S->fetch_size != 0 || S->lob) {
+		return 0;
+	}
+
+	if (cci_close_query_result(S->stmt_handle, &error) < 0) {
+		return 0;
+	}
+
+	return pdo_cubrid_stmt_cache_put(stmt->dbh, S->cache_sql, S->cache_sql_len, 
+			S->stmt_handle, S->bind_num, S->param_info);
+}
+
 static int cubrid_stmt_execute(pdo_stmt_t *stmt TSRMLS_DC)
 {
 	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
@@ -200,6 +380,10 @@ static int cubrid_stmt_execute(pdo_stmt_t *stmt TSRMLS_DC)
 		return 0;
 	}
 
+	/* the buffered rows and the decoders belong to the previous result */
+	cubrid_scroll_buffer_free(S);
+	cubrid_free_decoders(S);
+
 	if ((cubrid_retval = cci_fetch_buffer_clear(S->stmt_handle)) < 0) {
 		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
 		return 0;
@@ -236,6 +420,15 @@ static int cubrid_stmt_execute(pdo_stmt_t *stmt TSRMLS_DC)
 		return 0;
     }
 
+	if (S->col_desc && !cubrid_col_desc_matches(S, res_col_info, res_col_count)) {
+		cubrid_free_col_desc(S);
+	}
+
+	/* the cardinality of the new result is unknown again */
+	for (i = 0; S->col_desc && i < S->col_desc_count; i++) {
+		cubrid_dedup_reset(&S->col_desc[i]);
+	}
+
 	S->col_info = res_col_info;
 	S->sql_type = res_sql_type;
 	S->col_count = res_col_count;
@@ -260,6 +453,11 @@ static int cubrid_stmt_execute(pdo_stmt_t *stmt TSRMLS_DC)
     }
 
 	S->cursor_pos = 1;
+	S->cursor_row = 0;
+	S->result_seq++;
+	S->cur_fetch_size = 0;
+	S->fetch_mark = 0;
+	S->fetch_consumed = 0;
 
 	for (i = 0; i < S->bind_num; i++) {
 		S->l_bind[i] = 0;
@@ -475,6 +673,50 @@ static T_CCI_SET cubrid_create_set_by_param(zval *parameter,int type)
     
     return set;
 }
+/* Set of BIT/VARBIT elements from PHP binary strings, without the '0'/'1' text of cubrid_str2bit */
+static T_CCI_SET cubrid_create_bit_set_by_param(zval *parameter, int type)
+{
+    T_CCI_SET set = NULL;
+    T_CCI_BIT *bits = NULL;
+    int *indicator = NULL;
+    int count, i = 0;
+    zval *z_item;
+
+    count = zend_hash_num_elements(Z_ARRVAL_P(parameter));
+
+    bits = (T_CCI_BIT *) safe_emalloc(count + 1, sizeof(T_CCI_BIT), 0);
+    indicator = (int *) safe_emalloc(count + 1, sizeof(int), 0);
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(parameter), z_item) {
+        ZVAL_DEREF(z_item);
+
+        if (Z_TYPE_P(z_item) == IS_NULL) {
+            indicator[i] = 1;
+            bits[i].size = 0;
+            bits[i].buf = NULL;
+        } else if (Z_TYPE_P(z_item) == IS_STRING) {
+            indicator[i] = 0;
+            bits[i].size = Z_STRLEN_P(z_item);
+            bits[i].buf = Z_STRVAL_P(z_item);
+        } else {
+            efree(bits);
+            efree(indicator);
+            return NULL;
+        }
+
+        i++;
+    } ZEND_HASH_FOREACH_END();
+
+    if (cci_set_make(&set, type, count, bits, indicator) < 0) {
+        set = NULL;
+    }
+
+    efree(bits);
+    efree(indicator);
+
+    return set;
+}
+
 static int cubrid_type_pdo2cubrid(int pdo_type)
 {
     switch (pdo_type) 
@@ -516,6 +758,102 @@ static int cubrid_stmt_datatype_convert(int type)
     return u_type;
 }
 
+/* Bind a scalar in its own representation, nothing is formatted as text: ints go as BIGINT, floats
+ * as DOUBLE, bools as INT and DateTimeInterface objects as DATETIME, or as u_type when the type was
+ * named in driver_options. Other values are bound as text without converting the caller's variable. */
+static int cubrid_bind_native(pdo_stmt_t *stmt, int bind_index, zval *parameter, T_CCI_U_TYPE u_type, 
+		int named TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	CUBRID_LONG_LONG bigint_val;
+	double double_val;
+	int int_val;
+	T_CCI_DATE date_val;
+	php_date_obj *dateobj;
+	zend_string *str;
+	int cubrid_retval = 0;
+
+	switch (Z_TYPE_P(parameter)) {
+	case IS_LONG:
+		bigint_val = (CUBRID_LONG_LONG)Z_LVAL_P(parameter);
+
+		return cci_bind_param(S->stmt_handle, bind_index, CCI_A_TYPE_BIGINT, &bigint_val, 
+				named ? u_type : CCI_U_TYPE_BIGINT, 0);
+	case IS_DOUBLE:
+		double_val = Z_DVAL_P(parameter);
+
+		return cci_bind_param(S->stmt_handle, bind_index, CCI_A_TYPE_DOUBLE, &double_val, 
+				named ? u_type : CCI_U_TYPE_DOUBLE, 0);
+	case IS_TRUE:
+	case IS_FALSE:
+		int_val = Z_TYPE_P(parameter) == IS_TRUE ? 1 : 0;
+
+		return cci_bind_param(S->stmt_handle, bind_index, CCI_A_TYPE_INT, &int_val, 
+				named ? u_type : CCI_U_TYPE_INT, 0);
+	case IS_STRING:
+		return cci_bind_param(S->stmt_handle, bind_index, CCI_A_TYPE_STR, Z_STRVAL_P(parameter), u_type, 0);
+	case IS_OBJECT:
+		if (!instanceof_function(Z_OBJCE_P(parameter), php_date_get_interface_ce() TSRMLS_CC)) {
+			break;
+		}
+
+		dateobj = Z_PHPDATE_P(parameter);
+		if (!dateobj->time) {
+			return CUBRID_ER_INVALID_PARAM;
+		}
+
+		/* the wall clock time of the object, as DateTime::format would print it */
+		memset(&date_val, 0, sizeof(T_CCI_DATE));
+		date_val.yr = (int)dateobj->time->y;
+		date_val.mon = (int)dateobj->time->m;
+		date_val.day = (int)dateobj->time->d;
+		date_val.hh = (int)dateobj->time->h;
+		date_val.mm = (int)dateobj->time->i;
+		date_val.ss = (int)dateobj->time->s;
+#if PHP_VERSION_ID >= 70100
+		date_val.ms = (int)(dateobj->time->us / 1000);
+#else
+		date_val.ms = (int)(dateobj->time->f * 1000);
+#endif
+
+		return cci_bind_param(S->stmt_handle, bind_index, CCI_A_TYPE_DATE, &date_val, 
+				named ? u_type : CCI_U_TYPE_DATETIME, 0);
+	default:
+		break;
+	}
+
+	str = zval_get_string(parameter);
+	cubrid_retval = cci_bind_param(S->stmt_handle, bind_index, CCI_A_TYPE_STR, ZSTR_VAL(str), u_type, 0);
+	zend_string_release(str);
+
+	return cubrid_retval;
+}
+
+/* The type the server reported for a placeholder when the statement was prepared, if a value
+ * can be bound to it directly. CCI_U_TYPE_UNKNOWN leaves the choice to the value. */
+static T_CCI_U_TYPE cubrid_param_server_type(pdo_cubrid_stmt *S, int bind_index, zval *parameter)
+{
+	T_CCI_U_TYPE type;
+
+	if (!S->param_info || bind_index < 1 || bind_index > S->bind_num) {
+		return CCI_U_TYPE_UNKNOWN;
+	}
+
+	type = CCI_GET_PARAM_INFO_TYPE(S->param_info, bind_index);
+
+	if (!CUBRID_IS_NUMBER_TYPE(type) && !CUBRID_IS_STRING_TYPE(type) && !CUBRID_IS_DATE_TYPE(type)) {
+		return CCI_U_TYPE_UNKNOWN;
+	}
+
+	/* the server rounds a float stored into an integer, CCI would truncate it */
+	if (Z_TYPE_P(parameter) == IS_DOUBLE && CUBRID_IS_INTEGER_TYPE(type)) {
+		return CCI_U_TYPE_UNKNOWN;
+	}
+
+	return type;
+}
+
 static int cubrid_stmt_param_hook(pdo_stmt_t *stmt, struct pdo_bound_param_data *param, 
 		enum pdo_param_event event_type TSRMLS_DC)
 {
@@ -523,14 +861,17 @@ static int cubrid_stmt_param_hook(pdo_stmt_t *stmt, struct pdo_bound_param_data
 
     pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
 
-    char *bind_value = NULL, *bind_value_type = NULL;
-    int bind_value_len, bind_index,i=0;
+    char *bind_value_type = NULL;
+    int bind_index,i=0;
 
     T_CCI_U_TYPE u_type;
     T_CCI_U_TYPE e_type;//element'datatype of set 
+    T_CCI_U_TYPE s_type = CCI_U_TYPE_UNKNOWN;
     T_CCI_A_TYPE a_type;
 
-    T_CCI_BIT *bit_value = NULL;
+    T_CCI_BIT bit_bind;
+    zend_string *bind_str;
+    zval bool_str;
     T_CCI_LOB lob = NULL;
 
     php_stream *stm = NULL;
@@ -590,6 +931,10 @@ static int cubrid_stmt_param_hook(pdo_stmt_t *stmt, struct pdo_bound_param_data
                 	case PDO_PARAM_LOB:
                 		u_type = CCI_U_TYPE_BLOB;
 
+                		break;
+                	case PDO_PARAM_BOOL:
+                		u_type = CCI_U_TYPE_INT;
+
                 		break;
                 	case PDO_PARAM_NULL:
                 		u_type = CCI_U_TYPE_NULL;
@@ -601,9 +946,19 @@ static int cubrid_stmt_param_hook(pdo_stmt_t *stmt, struct pdo_bound_param_data
                 	return 0;
             }
 
+            if (Z_TYPE(param->driver_params) == IS_STRING)
+            {
+                if ((u_type = get_cubrid_u_type_by_name(Z_STRVAL(param->driver_params))) == CCI_U_TYPE_UNKNOWN)
+                {
+                    pdo_cubrid_error_stmt(stmt, CUBRID_ER_NOT_SUPPORTED_TYPE, NULL, NULL);
+                    return 0;
+                }
+            }
+
             if(Z_TYPE_P(parameter) == IS_ARRAY)
             {
-                e_type = cubrid_type_pdo2cubrid(u_type);
+                /* a named type is the type of the elements */
+                e_type = Z_TYPE(param->driver_params) == IS_STRING ? u_type : cubrid_type_pdo2cubrid(u_type);
                 u_type = CCI_U_TYPE_SET;                    
             }
 
@@ -638,16 +993,21 @@ static int cubrid_stmt_param_hook(pdo_stmt_t *stmt, struct pdo_bound_param_data
                 } 
                 else if(u_type == CCI_U_TYPE_SET)
                 {
-                    set = cubrid_create_set_by_param(parameter, e_type);
+                    if (S->bit_binary && (e_type == CCI_U_TYPE_BIT || e_type == CCI_U_TYPE_VARBIT))
+                    {
+                        set = cubrid_create_bit_set_by_param(parameter, e_type);
+                    }
+                    else
+                    {
+                        set = cubrid_create_set_by_param(parameter, e_type);
+                    }
+
                     if(set == NULL)
                    {
+                       pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_PARAM, NULL, NULL);
                        return 0;
                    }    
                 }
-                else 
-                {
-            		convert_to_string(parameter);
-                }
 
                 switch (u_type) 
                 {
@@ -712,17 +1072,15 @@ static int cubrid_stmt_param_hook(pdo_stmt_t *stmt, struct pdo_bound_param_data
                     S->lob->lob = lob;
                     S->lob->type = u_type;
                 } 
-                else if (u_type == CCI_U_TYPE_BIT) 
+                else if (u_type == CCI_U_TYPE_BIT || u_type == CCI_U_TYPE_VARBIT) 
                 {
-                    bind_value = Z_STRVAL_P(parameter);
-                    bind_value_len = Z_STRLEN_P(parameter);
-                    bit_value = (T_CCI_BIT *) emalloc(sizeof(T_CCI_BIT));
-                    bit_value->size = bind_value_len;
-                    bit_value->buf = bind_value;
+                    /* the string bytes are the bits, CCI copies them */
+                    bind_str = zval_get_string(parameter);
+                    bit_bind.size = ZSTR_LEN(bind_str);
+                    bit_bind.buf = ZSTR_VAL(bind_str);
 
-                    cubrid_retval = cci_bind_param(S->stmt_handle, bind_index, a_type, (void *) bit_value, u_type, 0);
-
-                    efree(bit_value);
+                    cubrid_retval = cci_bind_param(S->stmt_handle, bind_index, a_type, (void *) &bit_bind, u_type, 0);
+                    zend_string_release(bind_str);
                 } 
                 else if(u_type == CCI_U_TYPE_SET)
                 {
@@ -731,8 +1089,32 @@ static int cubrid_stmt_param_hook(pdo_stmt_t *stmt, struct pdo_bound_param_data
                 }
                 else 
                 {
-                    bind_value = Z_STRVAL_P(parameter);
-                    cubrid_retval = cci_bind_param(S->stmt_handle, bind_index, a_type, bind_value, u_type, 0);
+                    /* a bool bound as a string keeps its PHP string form, "1" or "" */
+                    if (PDO_PARAM_TYPE(param->param_type) == PDO_PARAM_STR && 
+                    		(Z_TYPE_P(parameter) == IS_TRUE || Z_TYPE_P(parameter) == IS_FALSE))
+                    {
+                        ZVAL_STR(&bool_str, zval_get_string(parameter));
+                        parameter = &bool_str;
+                    }
+
+                    /* bound as the placeholder's own type so that the server has nothing to cast,
+                     * a value CCI can not convert is left to the server as before */
+                    if (Z_TYPE(param->driver_params) != IS_STRING && 
+                    		(s_type = cubrid_param_server_type(S, bind_index, parameter)) != CCI_U_TYPE_UNKNOWN)
+                    {
+                        cubrid_retval = cubrid_bind_native(stmt, bind_index, parameter, s_type, 1 TSRMLS_CC);
+                    }
+
+                    if (s_type == CCI_U_TYPE_UNKNOWN || cubrid_retval == CCI_ER_TYPE_CONVERSION)
+                    {
+                        cubrid_retval = cubrid_bind_native(stmt, bind_index, parameter, u_type, 
+                        		Z_TYPE(param->driver_params) == IS_STRING TSRMLS_CC);
+                    }
+
+                    if (parameter == &bool_str)
+                    {
+                        zval_ptr_dtor(&bool_str);
+                    }
                 } 
             }
 
@@ -784,6 +1166,25 @@ static int cubrid_stmt_fetch(pdo_stmt_t *stmt, enum pdo_fetch_orientation ori, l
 		return 0;
 	}
 
+	if (S->scroll_state == CUBRID_SCROLL_NONE && CUBRID_SCROLL_BUFFERED(S) && S->sql_type == CUBRID_STMT_SELECT) {
+		if (cubrid_scroll_buffer_load(stmt TSRMLS_CC) == FAILURE) {
+			return 0;
+		}
+
+		if (S->scroll_state == CUBRID_SCROLL_UNBUFFERED && S->cursor_pos != 1) {
+			/* loading moved the CCI cursor, the request is still relative to before the first row */
+			if (ori == PDO_FETCH_ORI_NEXT) {
+				ori = PDO_FETCH_ORI_FIRST;
+			} else if (ori == PDO_FETCH_ORI_REL) {
+				ori = PDO_FETCH_ORI_ABS;
+			}
+		}
+	}
+
+	if (S->scroll_state == CUBRID_SCROLL_LOADED) {
+		return cubrid_scroll_buffer_fetch(S, ori, offset);
+	}
+
 	switch (ori) {
 	case PDO_FETCH_ORI_FIRST:
 		origin = CCI_CURSOR_FIRST;	
@@ -833,6 +1234,10 @@ static int cubrid_stmt_fetch(pdo_stmt_t *stmt, enum pdo_fetch_orientation ori, l
 		return 0;
 	} 
 
+	if (S->fetch_size == CUBRID_FETCH_SIZE_ADAPTIVE) {
+		cubrid_adapt_fetch_size(S, ori, abs_offset);
+	}
+
 	cubrid_retval = cci_cursor(S->stmt_handle, offset, origin, &error);
     if (cubrid_retval == CCI_ER_NO_MORE_DATA) {
 		return 0;
@@ -845,6 +1250,21 @@ static int cubrid_stmt_fetch(pdo_stmt_t *stmt, enum pdo_fetch_orientation ori, l
 
 	S->cursor_pos = abs_offset;
 
+	switch (ori) {
+	case PDO_FETCH_ORI_FIRST:
+		S->cursor_row = 1;
+		break;
+	case PDO_FETCH_ORI_LAST:
+		S->cursor_row = S->row_count;
+		break;
+	case PDO_FETCH_ORI_ABS:
+		S->cursor_row = offset;
+		break;
+	default:
+		S->cursor_row += offset;
+		break;
+	}
+
 	cubrid_retval = cci_fetch(S->stmt_handle, &error);
 	if (cubrid_retval < 0) {
 		pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
@@ -858,10 +1278,7 @@ static int cubrid_stmt_describe_col(pdo_stmt_t *stmt, int colno TSRMLS_DC)
 {
 	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
 	struct pdo_column_data *cols = stmt->columns;
-    char* str;
-
-    T_CCI_U_TYPE type;
-	long type_maxlen;
+	pdo_cubrid_col_desc *desc;
 
 	if (!S->col_info) {
 		pdo_cubrid_error_stmt(stmt, CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL, NULL);
@@ -878,31 +1295,28 @@ static int cubrid_stmt_describe_col(pdo_stmt_t *stmt, int colno TSRMLS_DC)
 		return 0;
 	}
 
-    str = CCI_GET_RESULT_INFO_NAME (S->col_info, colno + 1);
-	cols[colno].name = zend_string_init(str, strlen(str), 0);
-	cols[colno].precision = CCI_GET_RESULT_INFO_PRECISION (S->col_info, colno + 1);
-
-	type = CCI_GET_COLLECTION_DOMAIN(CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1));
-	if ((type_maxlen = get_cubrid_u_type_len(type)) == -1) {
-		type_maxlen = CCI_GET_RESULT_INFO_PRECISION(S->col_info, colno + 1); 
-		if (type == CCI_U_TYPE_NUMERIC) {
-			type_maxlen += 2; /* "," + "-" */
-		}
-    }
+	if (S->col_desc && S->col_desc_flags != CUBRID_COL_DESC_FLAGS(S, stmt->dbh)) {
+		cubrid_free_col_desc(S);
+	}
 
-	if (CCI_IS_COLLECTION_TYPE(CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1))) {
-		type_maxlen = MAX_LEN_SET;
-    }
+	if (!S->col_desc && cubrid_build_col_desc(stmt TSRMLS_CC) != SUCCESS) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_NO_MORE_MEMORY, NULL, NULL);
+		return 0;
+	}
 
-	cols[colno].maxlen = type_maxlen;
+	desc = &S->col_desc[colno];
 
-	if (type == CCI_U_TYPE_BLOB || type == CCI_U_TYPE_CLOB) {
-		cols[colno].param_type = PDO_PARAM_LOB;
+	if (stmt->dbh->desired_case == PDO_CASE_NATURAL || stmt->dbh->desired_case == stmt->dbh->native_case) {
+		cols[colno].name = zend_string_copy(desc->name);
 	} else {
-		/* should make decision later, use STR now */
-		cols[colno].param_type = PDO_PARAM_STR;
+		/* PDO changes the case of the name in place, keep the cached one intact */
+		cols[colno].name = zend_string_init(ZSTR_VAL(desc->name), ZSTR_LEN(desc->name), 0);
 	}
 
+	cols[colno].precision = desc->precision;
+	cols[colno].maxlen = desc->maxlen;
+	cols[colno].param_type = desc->param_type;
+
 	return 1;
 }
 
@@ -911,6 +1325,7 @@ static int cubrid_stmt_get_column_meta(pdo_stmt_t *stmt, long colno, zval *retur
 	pdo_cubrid_stmt *S = (pdo_cubrid_stmt*)stmt->driver_data;
 
     char type_name[128];
+	T_CCI_ERROR error;
 	
 	if (!S->col_info) {
 		return FAILURE;
@@ -943,6 +1358,13 @@ static int cubrid_stmt_get_column_meta(pdo_stmt_t *stmt, long colno, zval *retur
     add_assoc_long(return_value, "reverse_index", S->col_info[colno].is_reverse_index);
     add_assoc_long(return_value, "reverse_unique", S->col_info[colno].is_reverse_unique);
 
+	if (CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1) == CCI_U_TYPE_ENUM && 
+			(S->col_desc || cubrid_build_col_desc(stmt TSRMLS_CC) == SUCCESS) && colno < S->col_desc_count &&
+			cubrid_enum_load_labels(stmt, colno, &error TSRMLS_CC) == 0) {
+		Z_ADDREF(S->col_desc[colno].enum_labels);
+		add_assoc_zval(return_value, "enum_labels", &S->col_desc[colno].enum_labels);
+	}
+
 	return 1;
 }
 
@@ -950,15 +1372,6 @@ static int cubrid_stmt_get_col_data(pdo_stmt_t *stmt, int colno, char **ptr, uns
 		int *caller_frees TSRMLS_DC)
 {
 	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
-	struct pdo_column_data *cols = stmt->columns; 
-
-	T_CCI_U_TYPE u_type;
-	T_CCI_A_TYPE a_type;
-	T_CCI_LOB lob = NULL;
-
-	int cubrid_retval = 0;
-	char *res_buf = NULL;
-    int ind = 0;
 
 	if (!S->stmt_handle) {
 		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
@@ -972,131 +1385,2718 @@ static int cubrid_stmt_get_col_data(pdo_stmt_t *stmt, int colno, char **ptr, uns
 
 	*caller_frees = 0;
 
-	switch (cols[colno].param_type) {
-	case PDO_PARAM_STR:
+	if (S->scroll_state == CUBRID_SCROLL_LOADED) {
+		return cubrid_scroll_buffer_get_col_data(stmt, colno, ptr, len TSRMLS_CC);
+	}
+
+	if (!S->decoders) {
+		cubrid_build_decoders(stmt TSRMLS_CC);
+	}
+
+	return S->decoders[colno](stmt, colno, ptr, len TSRMLS_CC);
+}
+
+/* Pick the converter of every column once per result, from the PDO type the column was
+ * described with and its CUBRID type. cubrid_stmt_get_col_data then only makes the call. */
+static void cubrid_build_decoders(pdo_stmt_t *stmt TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	pdo_cubrid_col_decoder decoder;
+
+	T_CCI_U_TYPE type;
+	int i;
+
+	S->decoders = (pdo_cubrid_col_decoder *) safe_emalloc(S->col_count, sizeof(pdo_cubrid_col_decoder), 0);
+
+	for (i = 0; i < S->col_count; i++) {
+		type = CCI_GET_RESULT_INFO_TYPE(S->col_info, i + 1);
+
+		switch (stmt->columns[i].param_type) {
+		case PDO_PARAM_STR:
+			if (S->bit_binary && (type == CCI_U_TYPE_BIT || type == CCI_U_TYPE_VARBIT)) {
+				decoder = cubrid_decode_bit;
+			} else {
+				decoder = cubrid_decode_str;
+			}
+			break;
+		case PDO_PARAM_LOB:
+			decoder = cubrid_decode_lob;
+			break;
+		case PDO_PARAM_INT:
+			if (type == CCI_U_TYPE_ENUM) {
+				decoder = cubrid_decode_enum_ordinal;
+			} else if (type == CCI_U_TYPE_NUMERIC) {
+				decoder = cubrid_decode_numeric_scaled;
+			} else if (type == CCI_U_TYPE_BIGINT) {
+				decoder = cubrid_decode_bigint;
+			} else {
+				decoder = cubrid_decode_int;
+			}
+			break;
 #if PDO_DRIVER_API >= 20080721
-	case PDO_PARAM_ZVAL:
+		case PDO_PARAM_ZVAL:
+			if (CCI_IS_COLLECTION_TYPE(type)) {
+				decoder = cubrid_decode_collection;
+			} else if (type == CCI_U_TYPE_BLOB || type == CCI_U_TYPE_CLOB) {
+				decoder = cubrid_decode_lob_inline;
+			} else if (type == CCI_U_TYPE_JSON) {
+				decoder = cubrid_decode_json;
+			} else if (type == CCI_U_TYPE_ENUM) {
+				decoder = cubrid_decode_enum_label;
+			} else if (CUBRID_IS_STRING_TYPE(type)) {
+				decoder = cubrid_decode_string_zval;
+			} else if (CUBRID_IS_DATE_TZ_TYPE(type)) {
+				decoder = cubrid_decode_date_tz;
+			} else if (CUBRID_IS_DATE_TYPE(type)) {
+				decoder = cubrid_decode_date;
+			} else {
+				decoder = cubrid_decode_double;
+			}
+			break;
 #endif
-		if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_STR, &res_buf, &ind)) < 0) {
-			pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
-			return 0;
+		default:
+			decoder = cubrid_decode_none;
+			break;
 		}
 
-		if (ind < 0) {
-			*ptr = NULL;
-			*len = 0;
-		} else {
-			*ptr = res_buf;
-			*len = ind;
-		}
+		S->decoders[i] = decoder;
+	}
+}
 
-		break;
-	case PDO_PARAM_LOB:
-		u_type = CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1);
+static void cubrid_free_decoders(pdo_cubrid_stmt *S)
+{
+	if (S->decoders) {
+		efree(S->decoders);
+		S->decoders = NULL;
+	}
+}
 
-		if (u_type == CCI_U_TYPE_BLOB) {
-			a_type = CCI_A_TYPE_BLOB;
-		} else if (u_type == CCI_U_TYPE_CLOB) {
-			a_type = CCI_A_TYPE_CLOB;
-		} else {
-			return 0;
-		}
+static int cubrid_decode_none(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	return 0;
+}
 
-		if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, a_type, (void *) &lob, &ind)) < 0) {
-			pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
-			return 0;
-		}
+static int cubrid_decode_str(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
 
-		if (ind < 0) {
-			return 0;
-		}
+	int cubrid_retval = 0;
+	char *res_buf = NULL;
+	int ind = 0;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_STR, &res_buf, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
 
-		*ptr = (char *)cubrid_create_lob_stream(stmt, lob, u_type TSRMLS_CC);
+	if (ind < 0) {
+		*ptr = NULL;
 		*len = 0;
+	} else {
+		*ptr = res_buf;
+		*len = ind;
+	}
 
-		return *ptr ? 1 : 0;
-	case PDO_PARAM_INT:
+	return 1;
+}
 
-		break;
-	default:
+/* BIT/VARBIT as the raw bytes, half the size of the hex text CCI_A_TYPE_STR makes */
+static int cubrid_decode_bit(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	int ind = 0;
+	T_CCI_BIT bit_val;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_BIT, &bit_val, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
 		return 0;
 	}
-	
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+	} else {
+		*ptr = bit_val.buf;
+		*len = bit_val.size;
+	}
+
 	return 1;
 }
 
-static int cubrid_stmt_next_rowset(pdo_stmt_t *stmt TSRMLS_DC)
+static int cubrid_decode_lob(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
 {
-	pdo_cubrid_stmt *S = (pdo_cubrid_stmt*)stmt->driver_data;
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
 
-    T_CCI_COL_INFO *res_col_info;
-    T_CCI_CUBRID_STMT res_sql_type;
-    int res_col_count = 0;
+	T_CCI_U_TYPE u_type;
+	T_CCI_A_TYPE a_type;
+	T_CCI_LOB lob = NULL;
 
-	int exec_ret = 0;
-	T_CCI_ERROR error;
+	int cubrid_retval = 0;
+	int ind = 0;
 
-	exec_ret = cci_next_result(S->stmt_handle, &error);
-	if (exec_ret == CAS_ER_NO_MORE_RESULT_SET) {
+	u_type = CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1);
+
+	if (u_type == CCI_U_TYPE_BLOB) {
+		a_type = CCI_A_TYPE_BLOB;
+	} else if (u_type == CCI_U_TYPE_CLOB) {
+		a_type = CCI_A_TYPE_CLOB;
+	} else {
 		return 0;
 	}
 
-	if (exec_ret < 0) {
-		pdo_cubrid_error_stmt(stmt, exec_ret, &error, NULL);
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, a_type, (void *) &lob, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
 		return 0;
 	}
 
-	res_col_info = cci_get_result_info(S->stmt_handle, &res_sql_type, &res_col_count);
-    if (res_sql_type == CUBRID_STMT_SELECT && !res_col_info) {
-		pdo_cubrid_error_stmt(stmt, CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL, NULL);
+	if (ind < 0) {
 		return 0;
-    }
+	}
+
+	*ptr = (char *)cubrid_create_lob_stream(stmt, lob, u_type TSRMLS_CC);
+	*len = 0;
+
+	return *ptr ? 1 : 0;
+}
+
+static int cubrid_decode_int(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	int ind = 0;
+	int int_val = 0;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_INT, &int_val, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+	} else {
+		S->col_long = (zend_long)int_val;
+		*ptr = (char *)&S->col_long;
+		*len = sizeof(zend_long);
+	}
+
+	return 1;
+}
+
+static int cubrid_decode_bigint(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	int ind = 0;
+	CUBRID_LONG_LONG bigint_val = 0;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_BIGINT, &bigint_val, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+	} else {
+		S->col_long = (zend_long)bigint_val;
+		*ptr = (char *)&S->col_long;
+		*len = sizeof(zend_long);
+	}
+
+	return 1;
+}
+
+static int cubrid_decode_numeric_scaled(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	char *res_buf = NULL;
+	int ind = 0;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_STR, &res_buf, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	if (cubrid_numeric_to_scaled(res_buf, CCI_GET_RESULT_INFO_SCALE(S->col_info, colno + 1), 
+				&S->col_long) == FAILURE) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_VALUE_OUT_OF_RANGE, NULL, NULL);
+		return 0;
+	}
+
+	*ptr = (char *)&S->col_long;
+	*len = sizeof(zend_long);
+
+	return 1;
+}
+
+static int cubrid_decode_enum_ordinal(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	char *res_buf = NULL;
+	int ind = 0;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_STR, &res_buf, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	if (cubrid_enum_ordinal(stmt, colno, res_buf, ind, &S->col_long TSRMLS_CC) == FAILURE) {
+		return 0;
+	}
+
+	*ptr = (char *)&S->col_long;
+	*len = sizeof(zend_long);
+
+	return 1;
+}
+
+#if PDO_DRIVER_API >= 20080721
+/* PDO takes a PDO_PARAM_ZVAL value over with ZVAL_COPY_VALUE, so S->col_zval is only a carrier */
+
+static int cubrid_decode_collection(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	if (cubrid_stmt_set_to_zval(stmt, colno, &S->col_zval TSRMLS_CC) == FAILURE) {
+		return 0;
+	}
+
+	if (Z_TYPE(S->col_zval) == IS_NULL) {
+		*ptr = NULL;
+		*len = 0;
+	} else {
+		*ptr = (char *)&S->col_zval;
+		*len = sizeof(zval);
+	}
+
+	return 1;
+}
+
+static int cubrid_decode_json(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	char *res_buf = NULL;
+	int ind = 0;
+#ifdef HAVE_JSON
+	php_json_error_code json_error;
+#endif
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_STR, &res_buf, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+#ifdef HAVE_JSON
+	/* parsed straight from the CCI fetch buffer, no zend_string of the document is made */
+	json_error = JSON_G(error_code);
+
+	if (php_json_decode_ex(&S->col_zval, res_buf, ind, PHP_JSON_OBJECT_AS_ARRAY, 
+				PHP_JSON_PARSER_DEFAULT_DEPTH) == FAILURE) {
+		zval_ptr_dtor(&S->col_zval);
+		ZVAL_STRINGL(&S->col_zval, res_buf, ind);
+
+		/* a fetch is not a json_decode() call, json_last_error() keeps reporting the user's own */
+		JSON_G(error_code) = json_error;
+	}
+#else
+	ZVAL_STRINGL(&S->col_zval, res_buf, ind);
+#endif
+
+	*ptr = (char *)&S->col_zval;
+	*len = sizeof(zval);
+
+	return 1;
+}
+
+static int cubrid_decode_enum_label(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	char *res_buf = NULL;
+	int ind = 0;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_STR, &res_buf, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0 || (ind == 0 && stmt->dbh->oracle_nulls == PDO_NULL_EMPTY_STRING)) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	/* execute drops the description when a result has other columns, PDO does not describe again */
+	if ((S->col_desc || cubrid_build_col_desc(stmt TSRMLS_CC) == SUCCESS) && colno < S->col_desc_count) {
+		ZVAL_STR_COPY(&S->col_zval, cubrid_enum_shared_label(&S->col_desc[colno], res_buf, ind));
+	} else {
+		ZVAL_STRINGL(&S->col_zval, res_buf, ind);
+	}
+	*ptr = (char *)&S->col_zval;
+	*len = sizeof(zval);
+
+	return 1;
+}
+
+static int cubrid_decode_string_zval(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	char *res_buf = NULL;
+	int ind = 0;
+	zend_string *str;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_STR, &res_buf, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0 || (ind == 0 && stmt->dbh->oracle_nulls == PDO_NULL_EMPTY_STRING)) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	/* the only copy between the CCI fetch buffer and the PHP variable */
+	if (ind == 0) {
+		ZVAL_EMPTY_STRING(&S->col_zval);
+	} else if (S->dedup_strings && (str = cubrid_dedup_string(S, colno, res_buf, ind)) != NULL) {
+		ZVAL_STR_COPY(&S->col_zval, str);
+	} else {
+		ZVAL_STR(&S->col_zval, zend_string_init(res_buf, ind, 0));
+	}
+
+	*ptr = (char *)&S->col_zval;
+	*len = sizeof(zval);
+
+	return 1;
+}
+
+static int cubrid_decode_date(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	int ind = 0;
+	T_CCI_DATE date_val;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_DATE, &date_val, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	cubrid_date_to_zval(&date_val, NULL, CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1), 
+			S->fetch_dates, &S->col_zval TSRMLS_CC);
+	*ptr = (char *)&S->col_zval;
+	*len = sizeof(zval);
+
+	return 1;
+}
+
+static int cubrid_decode_date_tz(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	T_CCI_U_TYPE u_type;
+	int cubrid_retval = 0;
+	int ind = 0;
+	T_CCI_DATE date_val;
+	T_CCI_DATE_TZ date_tz_val;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_DATE_TZ, &date_tz_val, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	date_val.yr = date_tz_val.yr;
+	date_val.mon = date_tz_val.mon;
+	date_val.day = date_tz_val.day;
+	date_val.hh = date_tz_val.hh;
+	date_val.mm = date_tz_val.mm;
+	date_val.ss = date_tz_val.ss;
+	date_val.ms = date_tz_val.ms;
+
+	u_type = CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1);
+	cubrid_date_to_zval(&date_val, date_tz_val.tz,
+			(u_type == CCI_U_TYPE_TIMESTAMPTZ || u_type == CCI_U_TYPE_TIMESTAMPLTZ) ?
+			CCI_U_TYPE_TIMESTAMP : CCI_U_TYPE_DATETIME, S->fetch_dates, &S->col_zval TSRMLS_CC);
+	*ptr = (char *)&S->col_zval;
+	*len = sizeof(zval);
+
+	return 1;
+}
+
+static int cubrid_decode_double(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	int ind = 0;
+	double double_val = 0;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_DOUBLE, &double_val, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+	} else {
+		ZVAL_DOUBLE(&S->col_zval, double_val);
+		*ptr = (char *)&S->col_zval;
+		*len = sizeof(zval);
+	}
+
+	return 1;
+}
+
+/* PDO_CUBRID_ATTR_LOB_INLINE_SIZE: a LOB under the threshold is read into a string with a single
+ * read request and released at once, a larger one is handed out as a stream as before */
+static int cubrid_decode_lob_inline(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	T_CCI_U_TYPE u_type;
+	T_CCI_LOB lob = NULL;
+	T_CCI_ERROR error;
+	php_stream *stm;
+	zend_string *str;
+	pdo_int64_t size, offset = 0;
+
+	int cubrid_retval = 0;
+	int ind = 0;
+
+	u_type = CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1);
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, 
+				u_type == CCI_U_TYPE_BLOB ? CCI_A_TYPE_BLOB : CCI_A_TYPE_CLOB, (void *) &lob, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return 0;
+	}
+
+	if (ind < 0) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	if ((size = cubrid_lob_size(lob, u_type)) < 0) {
+		pdo_cubrid_error_stmt(stmt, (int)size, NULL, NULL);
+		cubrid_lob_free(lob, u_type);
+		return 0;
+	}
+
+	if (size >= S->lob_inline_size) {
+		if (!(stm = cubrid_create_lob_stream(stmt, lob, u_type TSRMLS_CC))) {
+			cubrid_lob_free(lob, u_type);
+			return 0;
+		}
+
+		php_stream_to_zval(stm, &S->col_zval);
+	} else {
+		str = zend_string_alloc((size_t)size, 0);
+
+		/* one request for the whole value, the loop only covers a short read */
+		while (offset < size) {
+			if ((cubrid_retval = cubrid_lob_read(S->H->conn_handle, lob, u_type, offset, 
+						(int)MIN(size - offset, INT_MAX), ZSTR_VAL(str) + offset, &error)) <= 0) {
+				zend_string_free(str);
+				cubrid_lob_free(lob, u_type);
+				if (cubrid_retval < 0) {
+					pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
+				} else {
+					pdo_cubrid_error_stmt(stmt, CUBRID_ER_TRANSFER_FAIL, NULL, NULL);
+				}
+				return 0;
+			}
+
+			offset += cubrid_retval;
+		}
+
+		ZSTR_VAL(str)[size] = '\0';
+		cubrid_lob_free(lob, u_type);
+
+		ZVAL_STR(&S->col_zval, str);
+	}
+
+	*ptr = (char *)&S->col_zval;
+	*len = sizeof(zval);
+
+	return 1;
+}
+#endif
+
+static int cubrid_stmt_next_rowset(pdo_stmt_t *stmt TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt*)stmt->driver_data;
+
+    T_CCI_COL_INFO *res_col_info;
+    T_CCI_CUBRID_STMT res_sql_type;
+    int res_col_count = 0;
+
+	int exec_ret = 0;
+	T_CCI_ERROR error;
+
+	cubrid_scroll_buffer_free(S);
+	cubrid_free_decoders(S);
+
+	exec_ret = cci_next_result(S->stmt_handle, &error);
+	if (exec_ret == CAS_ER_NO_MORE_RESULT_SET) {
+		return 0;
+	}
+
+	if (exec_ret < 0) {
+		pdo_cubrid_error_stmt(stmt, exec_ret, &error, NULL);
+		return 0;
+	}
+
+	res_col_info = cci_get_result_info(S->stmt_handle, &res_sql_type, &res_col_count);
+    if (res_sql_type == CUBRID_STMT_SELECT && !res_col_info) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL, NULL);
+		return 0;
+    }
+
+	/* the next result set has its own columns */
+	cubrid_free_col_desc(S);
 
 	S->col_info = res_col_info;
 	S->sql_type = res_sql_type;
 	S->col_count = res_col_count;
 
-	stmt->column_count = res_col_count;
-	stmt->row_count = exec_ret;
+	stmt->column_count = res_col_count;
+	stmt->row_count = exec_ret;
+
+	switch (S->sql_type) {
+    case CUBRID_STMT_SELECT:
+		S->row_count = exec_ret;
+		break;
+    case CUBRID_STMT_INSERT:
+    case CUBRID_STMT_UPDATE:
+    case CUBRID_STMT_DELETE:
+		S->affected_rows = exec_ret;
+		break;
+    case CUBRID_STMT_CALL:
+		S->row_count = exec_ret;
+		break;
+	default:
+		break;
+    }
+
+	S->cursor_pos = 1;
+	S->cursor_row = 0;
+	S->result_seq++;
+
+	return 1;
+}
+
+static int cubrid_stmt_set_attr(pdo_stmt_t *stmt, long attr, zval *val TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	zend_long lval;
+	int cubrid_retval = 0;
+
+	if (!S->stmt_handle) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
+		return 0;
+	}
+
+	switch (attr) {
+	case PDO_ATTR_PREFETCH:
+	case PDO_CUBRID_ATTR_FETCH_SIZE:
+		lval = zval_get_long(val);
+		if (lval < CUBRID_FETCH_SIZE_ADAPTIVE || lval > INT_MAX) {
+			pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		S->fetch_size = (int)lval;
+		S->cur_fetch_size = 0;
+		S->fetch_mark = 0;
+		S->fetch_consumed = 0;
+
+		if (S->fetch_size == CUBRID_FETCH_SIZE_ADAPTIVE) {
+			return 1;
+		}
+
+		if ((cubrid_retval = cci_fetch_size(S->stmt_handle, 
+						S->fetch_size ? S->fetch_size : CUBRID_FETCH_SIZE_DEFAULT)) < 0) {
+			pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+			return 0;
+		}
+
+		return 1;
+	case PDO_CUBRID_ATTR_MAX_ROWS:
+		lval = zval_get_long(val);
+		if (lval < 0 || lval > INT_MAX) {
+			pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		/* 0 removes the limit, it is applied from the next execute */
+		if ((cubrid_retval = cci_set_max_row(S->stmt_handle, (int)lval)) < 0) {
+			pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+			return 0;
+		}
+
+		S->max_rows = (int)lval;
+
+		return 1;
+	case PDO_CUBRID_ATTR_SCROLL_BUFFER_SIZE:
+		lval = zval_get_long(val);
+		if (lval < 0) {
+			pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			return 0;
+		}
+
+		/* applied from the next execute */
+		S->scroll_buffer_size = (long)lval;
+
+		return 1;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static int cubrid_stmt_get_attr(pdo_stmt_t *stmt, long attr, zval *val TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	switch (attr) {
+	case PDO_ATTR_PREFETCH:
+	case PDO_CUBRID_ATTR_FETCH_SIZE:
+		ZVAL_LONG(val, S->fetch_size);
+
+		break;
+	case PDO_CUBRID_ATTR_MAX_ROWS:
+		ZVAL_LONG(val, S->max_rows);
+
+		break;
+	case PDO_CUBRID_ATTR_FETCH_DATES:
+		ZVAL_LONG(val, S->fetch_dates);
+
+		break;
+	case PDO_CUBRID_ATTR_FETCH_COLLECTIONS:
+		ZVAL_BOOL(val, S->fetch_collections);
+
+		break;
+	case PDO_CUBRID_ATTR_SCROLL_BUFFER_SIZE:
+		ZVAL_LONG(val, S->scroll_buffer_size);
+
+		break;
+	case PDO_CUBRID_ATTR_NUMERIC_MODE:
+		ZVAL_LONG(val, S->numeric_mode);
+
+		break;
+	case PDO_CUBRID_ATTR_BIT_BINARY:
+		ZVAL_BOOL(val, S->bit_binary);
+
+		break;
+	case PDO_CUBRID_ATTR_FETCH_JSON:
+		ZVAL_BOOL(val, S->fetch_json);
+
+		break;
+	case PDO_CUBRID_ATTR_ENUM_MODE:
+		ZVAL_LONG(val, S->enum_mode);
+
+		break;
+	case PDO_CUBRID_ATTR_DEDUP_STRINGS:
+		ZVAL_BOOL(val, S->dedup_strings);
+
+		break;
+	case PDO_CUBRID_ATTR_LOB_INLINE_SIZE:
+		ZVAL_LONG(val, S->lob_inline_size);
+
+		break;
+	default:
+		return 0;
+	}
+
+	return 1;
+}
+
+struct pdo_stmt_methods cubrid_stmt_methods = {
+    cubrid_stmt_dtor, 
+	cubrid_stmt_execute, 
+	cubrid_stmt_fetch, 
+	cubrid_stmt_describe_col, 
+	cubrid_stmt_get_col_data, 
+	cubrid_stmt_param_hook, 
+	cubrid_stmt_set_attr,
+	cubrid_stmt_get_attr,
+    cubrid_stmt_get_column_meta, /* get column meta */
+	cubrid_stmt_next_rowset,
+	NULL, /* cursor closer */
+};
+
+/************************************************************************
+* CUBRID SPECIFIC STATEMENT METHODS
+************************************************************************/
+
+static PHP_METHOD(PDOStatement, cubrid_fetch_all)
+{
+	pdo_stmt_t *stmt;
+	pdo_cubrid_stmt *S;
+	struct pdo_column_data *cols;
+
+	zend_long how = PDO_FETCH_USE_DEFAULT;
+	long remaining;
+	int cubrid_retval = 0;
+	int i;
+
+	zval row, val;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|l", &how) == FAILURE) {
+		return;
+	}
+
+	stmt = Z_PDO_STMT_P(getThis());
+	S = (pdo_cubrid_stmt *)stmt->driver_data;
+	cols = stmt->columns;
+
+	strcpy(stmt->error_code, PDO_ERR_NONE);
+
+	if (!S || !S->stmt_handle) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
+		goto ERR_CUBRID_FETCH_ALL;
+	}
+
+	if (how == PDO_FETCH_USE_DEFAULT) {
+		how = stmt->default_fetch_type;
+	}
+
+	switch (how) {
+	case PDO_FETCH_ASSOC:
+	case PDO_FETCH_NUM:
+	case PDO_FETCH_BOTH:
+	case PDO_FETCH_COLUMN:
+		break;
+	default:
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_ARRAY_TYPE, NULL, NULL);
+		goto ERR_CUBRID_FETCH_ALL;
+	}
+
+	if (!stmt->executed || !stmt->column_count || !cols) {
+		array_init(return_value);
+		return;
+	}
+
+	/* S->cursor_pos is one past the current row, see cubrid_stmt_fetch */
+	remaining = S->row_count - S->cursor_pos + 1;
+	array_init_size(return_value, remaining > 0 ? (uint32_t)remaining : 0);
+
+	while ((cubrid_retval = cubrid_stmt_fetch_next(stmt TSRMLS_CC)) > 0) {
+		if (how == PDO_FETCH_COLUMN) {
+			if (cubrid_stmt_col_to_zval(stmt, 0, &val TSRMLS_CC) == FAILURE) {
+				goto ERR_CUBRID_FETCH_ALL;
+			}
+
+			zend_hash_next_index_insert_new(Z_ARRVAL_P(return_value), &val);
+			continue;
+		}
+
+		array_init_size(&row, how == PDO_FETCH_BOTH ? 2 * stmt->column_count : stmt->column_count);
+
+		for (i = 0; i < stmt->column_count; i++) {
+			if (cubrid_stmt_col_to_zval(stmt, i, &val TSRMLS_CC) == FAILURE) {
+				zval_ptr_dtor(&row);
+				goto ERR_CUBRID_FETCH_ALL;
+			}
+
+			if (how == PDO_FETCH_ASSOC || how == PDO_FETCH_BOTH) {
+				if (how == PDO_FETCH_BOTH) {
+					Z_TRY_ADDREF(val);
+				}
+				zend_symtable_update(Z_ARRVAL(row), cols[i].name, &val);
+			}
+
+			if (how == PDO_FETCH_NUM || how == PDO_FETCH_BOTH) {
+				zend_hash_index_update(Z_ARRVAL(row), i, &val);
+			}
+		}
+
+		zend_hash_next_index_insert_new(Z_ARRVAL_P(return_value), &row);
+	}
+
+	if (cubrid_retval < 0) {
+		goto ERR_CUBRID_FETCH_ALL;
+	}
+
+	return;
+
+ERR_CUBRID_FETCH_ALL:
+	if (Z_TYPE_P(return_value) == IS_ARRAY) {
+		zval_ptr_dtor(return_value);
+	}
+
+	pdo_handle_error(stmt->dbh, stmt);
+
+	RETURN_FALSE;
+}
+
+static PHP_METHOD(PDOStatement, cubrid_fetch_columns)
+{
+	pdo_stmt_t *stmt;
+	pdo_cubrid_stmt *S;
+	struct pdo_column_data *cols;
+
+	zval *lists = NULL;
+	int *native = NULL;
+	long remaining;
+	int cubrid_retval = 0;
+	int i;
+
+	zval val;
+
+	if (zend_parse_parameters_none() == FAILURE) {
+		return;
+	}
+
+	stmt = Z_PDO_STMT_P(getThis());
+	S = (pdo_cubrid_stmt *)stmt->driver_data;
+	cols = stmt->columns;
+
+	strcpy(stmt->error_code, PDO_ERR_NONE);
+
+	if (!S || !S->stmt_handle) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
+		pdo_handle_error(stmt->dbh, stmt);
+		RETURN_FALSE;
+	}
+
+	array_init(return_value);
+
+	if (!stmt->executed || !stmt->column_count || !cols) {
+		return;
+	}
+
+	remaining = S->row_count - S->cursor_pos + 1;
+	if (remaining < 0) {
+		remaining = 0;
+	}
+
+	lists = safe_emalloc(stmt->column_count, sizeof(zval), 0);
+	native = safe_emalloc(stmt->column_count, sizeof(int), 0);
+
+	for (i = 0; i < stmt->column_count; i++) {
+		array_init_size(&lists[i], (uint32_t)remaining);
+
+		/* numeric columns skip the CCI string conversion whatever the statement setting is */
+		native[i] = !stmt->dbh->stringify && S->scroll_state != CUBRID_SCROLL_LOADED && 
+			get_cubrid_native_param_type(CCI_GET_RESULT_INFO_TYPE(S->col_info, i + 1)) != PDO_PARAM_STR;
+	}
+
+	while ((cubrid_retval = cubrid_stmt_fetch_next(stmt TSRMLS_CC)) > 0) {
+		for (i = 0; i < stmt->column_count; i++) {
+			if (native[i]) {
+				cubrid_retval = cubrid_stmt_numeric_to_zval(stmt, i, 
+						CCI_GET_RESULT_INFO_TYPE(S->col_info, i + 1), &val TSRMLS_CC);
+			} else {
+				cubrid_retval = cubrid_stmt_col_to_zval(stmt, i, &val TSRMLS_CC);
+			}
+
+			if (cubrid_retval == FAILURE) {
+				cubrid_retval = -1;
+				break;
+			}
+
+			zend_hash_next_index_insert_new(Z_ARRVAL(lists[i]), &val);
+		}
+
+		if (cubrid_retval < 0) {
+			break;
+		}
+	}
+
+	for (i = 0; i < stmt->column_count; i++) {
+		if (cubrid_retval < 0) {
+			zval_ptr_dtor(&lists[i]);
+		} else {
+			zend_symtable_update(Z_ARRVAL_P(return_value), cols[i].name, &lists[i]);
+		}
+	}
+
+	efree(lists);
+	efree(native);
+
+	if (cubrid_retval < 0) {
+		zval_ptr_dtor(return_value);
+		pdo_handle_error(stmt->dbh, stmt);
+		RETURN_FALSE;
+	}
+}
+
+static PHP_METHOD(PDOStatement, cubrid_fetch_lazy)
+{
+	pdo_stmt_t *stmt;
+	pdo_cubrid_stmt *S;
+
+	int cubrid_retval = 0;
+
+	if (zend_parse_parameters_none() == FAILURE) {
+		return;
+	}
+
+	stmt = Z_PDO_STMT_P(getThis());
+	S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	strcpy(stmt->error_code, PDO_ERR_NONE);
+
+	if (!S || !S->stmt_handle) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
+		pdo_handle_error(stmt->dbh, stmt);
+		RETURN_FALSE;
+	}
+
+	if (!stmt->executed || !stmt->column_count || !stmt->columns) {
+		RETURN_FALSE;
+	}
+
+	/* only moves the cursor, no column is read here */
+	if ((cubrid_retval = cubrid_stmt_fetch_next(stmt TSRMLS_CC)) <= 0) {
+		if (cubrid_retval < 0) {
+			pdo_handle_error(stmt->dbh, stmt);
+		}
+		RETURN_FALSE;
+	}
+
+	cubrid_lazy_row_init(return_value, stmt TSRMLS_CC);
+}
+
+static PHP_METHOD(PDOStatement, cubrid_fetch_bound)
+{
+	pdo_stmt_t *stmt;
+	pdo_cubrid_stmt *S;
+	struct pdo_bound_param_data *param;
+
+	int cubrid_retval = 0;
+
+	if (zend_parse_parameters_none() == FAILURE) {
+		return;
+	}
+
+	stmt = Z_PDO_STMT_P(getThis());
+	S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	strcpy(stmt->error_code, PDO_ERR_NONE);
+
+	if (!S || !S->stmt_handle) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
+		pdo_handle_error(stmt->dbh, stmt);
+		RETURN_FALSE;
+	}
+
+	if (!stmt->executed || !stmt->column_count || !stmt->columns) {
+		RETURN_FALSE;
+	}
+
+	if ((cubrid_retval = cubrid_stmt_fetch_next(stmt TSRMLS_CC)) <= 0) {
+		if (cubrid_retval < 0) {
+			pdo_handle_error(stmt->dbh, stmt);
+		}
+		RETURN_FALSE;
+	}
+
+	if (stmt->bound_columns) {
+		ZEND_HASH_FOREACH_PTR(stmt->bound_columns, param) {
+			if (param->paramno < 0 || param->paramno >= stmt->column_count || !Z_ISREF(param->parameter)) {
+				continue;
+			}
+
+			if (cubrid_stmt_col_to_bound(stmt, param->paramno, Z_REFVAL(param->parameter), 
+						PDO_PARAM_TYPE(param->param_type) TSRMLS_CC) == FAILURE) {
+				pdo_handle_error(stmt->dbh, stmt);
+				RETURN_FALSE;
+			}
+		} ZEND_HASH_FOREACH_END();
+	}
+
+	RETURN_TRUE;
+}
+
+/* Fetch the remaining rows as objects of a class. The declared property of every column is
+ * looked up once, then each row is written straight into the property slots; columns with no
+ * declared property become dynamic properties and the constructor runs afterwards, as with
+ * PDO::FETCH_CLASS. */
+static PHP_METHOD(PDOStatement, cubrid_fetch_objects)
+{
+	pdo_stmt_t *stmt;
+	pdo_cubrid_stmt *S;
+	struct pdo_column_data *cols;
+
+	zend_class_entry *ce;
+	zend_property_info *prop_info;
+	zend_property_info **slots = NULL;
+	long remaining;
+	int cubrid_retval = 0;
+	int i;
+
+	zval obj, val, *slot;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "C", &ce) == FAILURE) {
+		return;
+	}
+
+	stmt = Z_PDO_STMT_P(getThis());
+	S = (pdo_cubrid_stmt *)stmt->driver_data;
+	cols = stmt->columns;
+
+	strcpy(stmt->error_code, PDO_ERR_NONE);
+
+	if (!S || !S->stmt_handle) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
+		goto ERR_CUBRID_FETCH_OBJECTS;
+	}
+
+	if (!stmt->executed || !stmt->column_count || !cols) {
+		array_init(return_value);
+		return;
+	}
+
+	/* resolve the property slot of each column once for the whole result */
+	slots = (zend_property_info **) safe_emalloc(stmt->column_count, sizeof(zend_property_info *), 0);
+
+	for (i = 0; i < stmt->column_count; i++) {
+		prop_info = zend_hash_find_ptr(&ce->properties_info, cols[i].name);
+
+		if (prop_info && !(prop_info->flags & ZEND_ACC_STATIC) &&
+				!((prop_info->flags & ZEND_ACC_PRIVATE) && prop_info->ce != ce)) {
+			slots[i] = prop_info;
+		} else {
+			slots[i] = NULL;
+		}
+	}
+
+	remaining = S->row_count - S->cursor_pos + 1;
+	array_init_size(return_value, remaining > 0 ? (uint32_t)remaining : 0);
+
+	while ((cubrid_retval = cubrid_stmt_fetch_next(stmt TSRMLS_CC)) > 0) {
+		if (object_init_ex(&obj, ce) == FAILURE) {
+			goto ERR_CUBRID_FETCH_OBJECTS;
+		}
+
+		for (i = 0; i < stmt->column_count; i++) {
+			if (cubrid_stmt_col_to_zval(stmt, i, &val TSRMLS_CC) == FAILURE) {
+				zval_ptr_dtor(&obj);
+				goto ERR_CUBRID_FETCH_OBJECTS;
+			}
+
+			if (!slots[i]) {
+				zend_update_property_ex(ce, &obj, cols[i].name, &val);
+				zval_ptr_dtor(&val);
+				continue;
+			}
+
+#if PHP_VERSION_ID >= 70400
+			/* coerces val in place, or throws a TypeError */
+			if (ZEND_TYPE_IS_SET(slots[i]->type) && !zend_verify_property_type(slots[i], &val, 0)) {
+				zval_ptr_dtor(&val);
+				zval_ptr_dtor(&obj);
+				goto ERR_CUBRID_FETCH_OBJECTS;
+			}
+#endif
+
+			slot = OBJ_PROP(Z_OBJ(obj), slots[i]->offset);
+			zval_ptr_dtor(slot);
+			ZVAL_COPY_VALUE(slot, &val);
+		}
+
+		if (ce->constructor) {
+			zend_call_method(&obj, ce, &ce->constructor, ZSTR_VAL(ce->constructor->common.function_name),
+					ZSTR_LEN(ce->constructor->common.function_name), NULL, 0, NULL, NULL);
+
+			if (EG(exception)) {
+				zval_ptr_dtor(&obj);
+				goto ERR_CUBRID_FETCH_OBJECTS;
+			}
+		}
+
+		zend_hash_next_index_insert_new(Z_ARRVAL_P(return_value), &obj);
+	}
+
+	if (cubrid_retval < 0) {
+		goto ERR_CUBRID_FETCH_OBJECTS;
+	}
+
+	efree(slots);
+	return;
+
+ERR_CUBRID_FETCH_OBJECTS:
+	if (slots) {
+		efree(slots);
+	}
+
+	if (Z_TYPE_P(return_value) == IS_ARRAY) {
+		zval_ptr_dtor(return_value);
+	}
+
+	if (EG(exception)) {
+		RETURN_NULL();
+	}
+
+	pdo_handle_error(stmt->dbh, stmt);
+	RETURN_FALSE;
+}
+
+/* The values of one placeholder across the rows of cubrid_execute_batch, as a CCI array */
+typedef struct {
+	T_CCI_A_TYPE a_type;
+	T_CCI_U_TYPE u_type;
+	void *values;
+	int *null_ind;
+	zend_string **strs;		/* CCI_A_TYPE_STR: the strings values points into */
+} cubrid_batch_param;
+
+/* Pick the array type of placeholder i from the values of every row: ints and bools go as BIGINT,
+ * numbers as DOUBLE, DateTimeInterface objects as dates and anything else as text. The target type
+ * is the one the server reported for the placeholder when there is one. */
+static int cubrid_batch_param_type(pdo_cubrid_stmt *S, int i, zval **vals, int row_count, cubrid_batch_param *bp)
+{
+	zval *val;
+	int all_long = 1, all_number = 1, all_date = 1;
+	int r;
+
+	for (r = 0; r < row_count; r++) {
+		val = vals[r * S->bind_num + i];
+
+		switch (Z_TYPE_P(val)) {
+		case IS_NULL:
+			break;
+		case IS_LONG:
+		case IS_TRUE:
+		case IS_FALSE:
+			all_date = 0;
+			break;
+		case IS_DOUBLE:
+			all_long = all_date = 0;
+			break;
+		case IS_OBJECT:
+			all_long = all_number = 0;
+			if (!instanceof_function(Z_OBJCE_P(val), php_date_get_interface_ce() TSRMLS_CC)) {
+				all_date = 0;
+			}
+			break;
+		case IS_ARRAY:
+		case IS_RESOURCE:
+			return FAILURE;
+		default:
+			all_long = all_number = all_date = 0;
+			break;
+		}
+	}
+
+	if (all_long) {
+		bp->a_type = CCI_A_TYPE_BIGINT;
+		bp->u_type = CCI_U_TYPE_BIGINT;
+		bp->values = safe_emalloc(row_count, sizeof(CUBRID_LONG_LONG), 0);
+	} else if (all_number) {
+		bp->a_type = CCI_A_TYPE_DOUBLE;
+		bp->u_type = CCI_U_TYPE_DOUBLE;
+		bp->values = safe_emalloc(row_count, sizeof(double), 0);
+	} else if (all_date) {
+		bp->a_type = CCI_A_TYPE_DATE;
+		bp->u_type = CCI_U_TYPE_DATETIME;
+		bp->values = safe_emalloc(row_count, sizeof(T_CCI_DATE), 0);
+	} else {
+		bp->a_type = CCI_A_TYPE_STR;
+		bp->u_type = CCI_U_TYPE_STRING;
+		bp->values = safe_emalloc(row_count, sizeof(char *), 0);
+		bp->strs = (zend_string **) ecalloc(row_count, sizeof(zend_string *));
+	}
+
+	bp->null_ind = (int *) ecalloc(row_count, sizeof(int));
+
+	if (S->param_info) {
+		T_CCI_U_TYPE type = CCI_GET_PARAM_INFO_TYPE(S->param_info, i + 1);
+
+		if ((CUBRID_IS_NUMBER_TYPE(type) || CUBRID_IS_STRING_TYPE(type) || CUBRID_IS_DATE_TYPE(type)) &&
+				!(bp->a_type == CCI_A_TYPE_DOUBLE && CUBRID_IS_INTEGER_TYPE(type))) {
+			bp->u_type = type;
+		}
+	}
+
+	return SUCCESS;
+}
+
+static int cubrid_batch_param_fill(cubrid_batch_param *bp, zval *val, int r TSRMLS_DC)
+{
+	php_date_obj *dateobj;
+	T_CCI_DATE *date;
+
+	if (Z_TYPE_P(val) == IS_NULL) {
+		bp->null_ind[r] = 1;
+		if (bp->a_type == CCI_A_TYPE_STR) {
+			((char **)bp->values)[r] = NULL;
+		}
+		return SUCCESS;
+	}
+
+	switch (bp->a_type) {
+	case CCI_A_TYPE_BIGINT:
+		((CUBRID_LONG_LONG *)bp->values)[r] = (CUBRID_LONG_LONG)zval_get_long(val);
+		break;
+	case CCI_A_TYPE_DOUBLE:
+		((double *)bp->values)[r] = zval_get_double(val);
+		break;
+	case CCI_A_TYPE_DATE:
+		dateobj = Z_PHPDATE_P(val);
+		if (!dateobj->time) {
+			return FAILURE;
+		}
+
+		date = &((T_CCI_DATE *)bp->values)[r];
+		memset(date, 0, sizeof(T_CCI_DATE));
+		date->yr = (int)dateobj->time->y;
+		date->mon = (int)dateobj->time->m;
+		date->day = (int)dateobj->time->d;
+		date->hh = (int)dateobj->time->h;
+		date->mm = (int)dateobj->time->i;
+		date->ss = (int)dateobj->time->s;
+#if PHP_VERSION_ID >= 70100
+		date->ms = (int)(dateobj->time->us / 1000);
+#else
+		date->ms = (int)(dateobj->time->f * 1000);
+#endif
+		break;
+	default:
+		bp->strs[r] = zval_get_string(val);
+		if (EG(exception)) {
+			return FAILURE;
+		}
+		((char **)bp->values)[r] = ZSTR_VAL(bp->strs[r]);
+		break;
+	}
+
+	return SUCCESS;
+}
+
+static void cubrid_batch_params_free(cubrid_batch_param *params, int bind_num, int row_count)
+{
+	int i, r;
+
+	for (i = 0; i < bind_num; i++) {
+		if (params[i].strs) {
+			for (r = 0; r < row_count; r++) {
+				if (params[i].strs[r]) {
+					zend_string_release(params[i].strs[r]);
+				}
+			}
+			efree(params[i].strs);
+		}
+
+		if (params[i].values) {
+			efree(params[i].values);
+		}
+
+		if (params[i].null_ind) {
+			efree(params[i].null_ind);
+		}
+	}
+
+	efree(params);
+}
+
+/* Execute the statement once for every row of parameter values in a single cci_execute_array
+ * request. Returns the affected row count of each row, false for a row that failed; the code and
+ * message of each failure are stored in errors under the index of the row. */
+static PHP_METHOD(PDOStatement, cubrid_execute_batch)
+{
+	pdo_stmt_t *stmt;
+	pdo_cubrid_stmt *S;
+
+	zval *rows, *errors = NULL, *row, *val;
+	zval **vals = NULL;
+	zval err;
+	cubrid_batch_param *params = NULL;
+	T_CCI_QUERY_RESULT *qr = NULL;
+	T_CCI_ERROR error;
+
+	zend_long total = 0;
+	int row_count = 0, res_count = 0, result;
+	int cubrid_retval = 0;
+	int i, r;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "a|z", &rows, &errors) == FAILURE) {
+		return;
+	}
+
+	stmt = Z_PDO_STMT_P(getThis());
+	S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	strcpy(stmt->error_code, PDO_ERR_NONE);
+
+	if (errors) {
+		ZVAL_DEREF(errors);
+		zval_ptr_dtor(errors);
+		array_init(errors);
+	}
+
+	if (!S || !S->stmt_handle) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_STMT_HANDLE, NULL, NULL);
+		goto ERR_CUBRID_EXECUTE_BATCH;
+	}
+
+	row_count = zend_hash_num_elements(Z_ARRVAL_P(rows));
+	if (row_count == 0) {
+		array_init(return_value);
+		return;
+	}
+
+	if (S->bind_num <= 0) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+		goto ERR_CUBRID_EXECUTE_BATCH;
+	}
+
+	/* the first bind_num values of each row, in order */
+	vals = (zval **) safe_emalloc(row_count, S->bind_num * sizeof(zval *), 0);
+
+	r = 0;
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(rows), row) {
+		ZVAL_DEREF(row);
+		if (Z_TYPE_P(row) != IS_ARRAY || zend_hash_num_elements(Z_ARRVAL_P(row)) < (uint32_t)S->bind_num) {
+			pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+			goto ERR_CUBRID_EXECUTE_BATCH;
+		}
+
+		i = 0;
+		ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(row), val) {
+			if (i == S->bind_num) {
+				break;
+			}
+			ZVAL_DEREF(val);
+			vals[r * S->bind_num + i++] = val;
+		} ZEND_HASH_FOREACH_END();
+
+		r++;
+	} ZEND_HASH_FOREACH_END();
+
+	params = (cubrid_batch_param *) ecalloc(S->bind_num, sizeof(cubrid_batch_param));
+
+	for (i = 0; i < S->bind_num; i++) {
+		if (cubrid_batch_param_type(S, i, vals, row_count, &params[i]) == FAILURE) {
+			pdo_cubrid_error_stmt(stmt, CUBRID_ER_NOT_SUPPORTED_TYPE, NULL, NULL);
+			goto ERR_CUBRID_EXECUTE_BATCH;
+		}
+
+		for (r = 0; r < row_count; r++) {
+			if (cubrid_batch_param_fill(&params[i], vals[r * S->bind_num + i], r TSRMLS_CC) == FAILURE) {
+				pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_PARAM, NULL, NULL);
+				goto ERR_CUBRID_EXECUTE_BATCH;
+			}
+		}
+	}
+
+	S->array_bound = 1;
+
+	if ((cubrid_retval = cci_bind_param_array_size(S->stmt_handle, row_count)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		goto ERR_CUBRID_EXECUTE_BATCH;
+	}
+
+	for (i = 0; i < S->bind_num; i++) {
+		if ((cubrid_retval = cci_bind_param_array(S->stmt_handle, i + 1, params[i].a_type, 
+					params[i].values, params[i].null_ind, params[i].u_type)) < 0) {
+			pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+			goto ERR_CUBRID_EXECUTE_BATCH;
+		}
+	}
+
+	if ((res_count = cci_execute_array(S->stmt_handle, &qr, &error)) < 0) {
+		pdo_cubrid_error_stmt(stmt, res_count, &error, NULL);
+		goto ERR_CUBRID_EXECUTE_BATCH;
+	}
+
+	array_init_size(return_value, res_count);
+
+	for (r = 1; r <= res_count; r++) {
+		result = CCI_QUERY_RESULT_RESULT(qr, r);
+
+		if (result < 0) {
+			add_next_index_bool(return_value, 0);
+
+			if (errors) {
+				array_init(&err);
+				add_assoc_long(&err, "code", CCI_QUERY_RESULT_ERR_NO(qr, r));
+				add_assoc_string(&err, "message", CCI_QUERY_RESULT_ERR_MSG(qr, r) ? 
+						CCI_QUERY_RESULT_ERR_MSG(qr, r) : "");
+				add_index_zval(errors, r - 1, &err);
+			}
+		} else {
+			add_next_index_long(return_value, result);
+			total += result;
+		}
+	}
+
+	cci_query_result_free(qr, res_count);
+	cubrid_batch_params_free(params, S->bind_num, row_count);
+	efree(vals);
+
+	S->affected_rows = (int)total;
+	stmt->row_count = total;
+
+	return;
+
+ERR_CUBRID_EXECUTE_BATCH:
+	if (params) {
+		cubrid_batch_params_free(params, S->bind_num, row_count);
+	}
+
+	if (vals) {
+		efree(vals);
+	}
+
+	pdo_handle_error(stmt->dbh, stmt);
+
+	RETURN_FALSE;
+}
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_cubrid_execute_batch, 0, 0, 1)
+	ZEND_ARG_ARRAY_INFO(0, rows, 0)
+	ZEND_ARG_INFO(1, errors)
+ZEND_END_ARG_INFO()
+
+const zend_function_entry cubrid_stmt_driver_methods[] = {
+	PHP_ME(PDOStatement, cubrid_fetch_all, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOStatement, cubrid_fetch_columns, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOStatement, cubrid_fetch_lazy, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOStatement, cubrid_fetch_bound, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOStatement, cubrid_fetch_objects, NULL, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOStatement, cubrid_execute_batch, arginfo_cubrid_execute_batch, ZEND_ACC_PUBLIC)
+	{NULL, NULL, NULL}
+};
+
+/************************************************************************
+* LAZY DATE CLASS
+************************************************************************/
+
+static zend_class_entry *cubrid_lazy_date_ce;
+static zend_object_handlers cubrid_lazy_date_handlers;
+
+static inline cubrid_lazy_date_obj *cubrid_lazy_date_from_obj(zend_object *obj)
+{
+	return (cubrid_lazy_date_obj *)((char *)obj - XtOffsetOf(cubrid_lazy_date_obj, std));
+}
+
+#define Z_CUBRID_LAZY_DATE_P(zv) cubrid_lazy_date_from_obj(Z_OBJ_P(zv))
+
+static zend_object *cubrid_lazy_date_create(zend_class_entry *ce)
+{
+	cubrid_lazy_date_obj *intern = ecalloc(1, sizeof(cubrid_lazy_date_obj) + zend_object_properties_size(ce));
+
+	zend_object_std_init(&intern->std, ce);
+	object_properties_init(&intern->std, ce);
+	ZVAL_UNDEF(&intern->datetime);
+	intern->type = CCI_U_TYPE_DATETIME;
+	intern->std.handlers = &cubrid_lazy_date_handlers;
+
+	return &intern->std;
+}
+
+static void cubrid_lazy_date_free(zend_object *object)
+{
+	cubrid_lazy_date_obj *intern = cubrid_lazy_date_from_obj(object);
+
+	zval_ptr_dtor(&intern->datetime);
+	zend_object_std_dtor(&intern->std);
+}
+
+static zval *cubrid_lazy_date_get_datetime(cubrid_lazy_date_obj *intern TSRMLS_DC)
+{
+	if (Z_TYPE(intern->datetime) == IS_UNDEF) {
+		cubrid_date_to_datetime(&intern->date, intern->tz, intern->type, &intern->datetime TSRMLS_CC);
+	}
+
+	return &intern->datetime;
+}
+
+static PHP_METHOD(PDOCubridLazyDate, toDateTime)
+{
+	if (zend_parse_parameters_none() == FAILURE) {
+		return;
+	}
+
+	ZVAL_COPY(return_value, cubrid_lazy_date_get_datetime(Z_CUBRID_LAZY_DATE_P(getThis()) TSRMLS_CC));
+}
+
+static PHP_METHOD(PDOCubridLazyDate, format)
+{
+	zval *format;
+	zval *datetime;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &format) == FAILURE) {
+		return;
+	}
+
+	datetime = cubrid_lazy_date_get_datetime(Z_CUBRID_LAZY_DATE_P(getThis()) TSRMLS_CC);
+	zend_call_method_with_1_params(datetime, Z_OBJCE_P(datetime), NULL, "format", return_value, format);
+}
+
+static PHP_METHOD(PDOCubridLazyDate, __toString)
+{
+	cubrid_lazy_date_obj *intern;
+	char buf[64 + MAX_LEN_TZ];
+	int len;
+
+	if (zend_parse_parameters_none() == FAILURE) {
+		return;
+	}
+
+	intern = Z_CUBRID_LAZY_DATE_P(getThis());
+	len = cubrid_date_to_str(&intern->date, intern->tz, intern->type, buf, sizeof(buf));
+
+	RETURN_STRINGL(buf, len);
+}
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_cubrid_lazy_date_format, 0, 0, 1)
+	ZEND_ARG_INFO(0, format)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO(arginfo_cubrid_lazy_date_void, 0)
+ZEND_END_ARG_INFO()
+
+static const zend_function_entry cubrid_lazy_date_methods[] = {
+	PHP_ME(PDOCubridLazyDate, toDateTime, arginfo_cubrid_lazy_date_void, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyDate, format, arginfo_cubrid_lazy_date_format, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyDate, __toString, arginfo_cubrid_lazy_date_void, ZEND_ACC_PUBLIC)
+	{NULL, NULL, NULL}
+};
+
+void pdo_cubrid_lazy_date_minit(TSRMLS_D)
+{
+	zend_class_entry ce;
+
+	INIT_CLASS_ENTRY(ce, "PDOCubridLazyDate", cubrid_lazy_date_methods);
+	cubrid_lazy_date_ce = zend_register_internal_class(&ce TSRMLS_CC);
+	cubrid_lazy_date_ce->ce_flags |= ZEND_ACC_FINAL;
+	cubrid_lazy_date_ce->create_object = cubrid_lazy_date_create;
+
+	memcpy(&cubrid_lazy_date_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+	cubrid_lazy_date_handlers.offset = XtOffsetOf(cubrid_lazy_date_obj, std);
+	cubrid_lazy_date_handlers.free_obj = cubrid_lazy_date_free;
+	cubrid_lazy_date_handlers.clone_obj = NULL;
+}
+
+/************************************************************************
+* LAZY ROW CLASS
+************************************************************************/
+
+static zend_class_entry *cubrid_lazy_row_ce;
+static zend_object_handlers cubrid_lazy_row_handlers;
+
+static inline cubrid_lazy_row_obj *cubrid_lazy_row_from_obj(zend_object *obj)
+{
+	return (cubrid_lazy_row_obj *)((char *)obj - XtOffsetOf(cubrid_lazy_row_obj, std));
+}
+
+#define Z_CUBRID_LAZY_ROW_P(zv) cubrid_lazy_row_from_obj(Z_OBJ_P(zv))
+
+static zend_object *cubrid_lazy_row_create(zend_class_entry *ce)
+{
+	cubrid_lazy_row_obj *intern = ecalloc(1, sizeof(cubrid_lazy_row_obj) + zend_object_properties_size(ce));
+
+	zend_object_std_init(&intern->std, ce);
+	object_properties_init(&intern->std, ce);
+	ZVAL_UNDEF(&intern->stmt);
+	intern->std.handlers = &cubrid_lazy_row_handlers;
+
+	return &intern->std;
+}
+
+static void cubrid_lazy_row_free(zend_object *object)
+{
+	cubrid_lazy_row_obj *intern = cubrid_lazy_row_from_obj(object);
+
+	cubrid_free_zvals(intern->values, intern->col_count);
+	zval_ptr_dtor(&intern->stmt);
+	zend_object_std_dtor(&intern->std);
+}
+
+/* Wrap the current row of the statement, the statement lives as long as the row */
+static void cubrid_lazy_row_init(zval *dest, pdo_stmt_t *stmt TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	cubrid_lazy_row_obj *intern;
+	int i;
+
+	object_init_ex(dest, cubrid_lazy_row_ce);
+	intern = Z_CUBRID_LAZY_ROW_P(dest);
+
+	ZVAL_OBJ(&intern->stmt, &stmt->std);
+	Z_ADDREF(intern->stmt);
+
+	intern->result_seq = S->result_seq;
+	intern->row = S->cursor_row;
+	intern->col_count = stmt->column_count;
+	intern->values = (zval *) safe_emalloc(intern->col_count, sizeof(zval), 0);
+
+	for (i = 0; i < intern->col_count; i++) {
+		ZVAL_UNDEF(&intern->values[i]);
+	}
+}
+
+/* Column index of an offset or property name, -1 if the row has no such column */
+static int cubrid_lazy_row_colno(cubrid_lazy_row_obj *intern, zval *offset)
+{
+	pdo_stmt_t *stmt = Z_PDO_STMT_P(&intern->stmt);
+	zend_string *name;
+	int i, colno = -1;
+
+	if (Z_TYPE_P(offset) == IS_LONG) {
+		return (Z_LVAL_P(offset) >= 0 && Z_LVAL_P(offset) < intern->col_count) ? (int)Z_LVAL_P(offset) : -1;
+	}
+
+	if (!stmt->columns) {
+		return -1;
+	}
+
+	name = zval_get_string(offset);
+
+	for (i = 0; i < intern->col_count && i < stmt->column_count; i++) {
+		if (zend_string_equals(stmt->columns[i].name, name)) {
+			colno = i;
+			break;
+		}
+	}
+
+	zend_string_release(name);
+
+	return colno;
+}
+
+/* Decode a column of the row on its first read. When the statement has moved on since,
+ * the CCI cursor is put back on the row for the read and returned afterwards. */
+static zval *cubrid_lazy_row_value(cubrid_lazy_row_obj *intern, int colno TSRMLS_DC)
+{
+	pdo_stmt_t *stmt = Z_PDO_STMT_P(&intern->stmt);
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	long cur_row, scroll_row;
+	int cubrid_retval = 0;
+	int ret;
+	T_CCI_ERROR error;
+
+	if (Z_TYPE(intern->values[colno]) != IS_UNDEF) {
+		return &intern->values[colno];
+	}
+
+	strcpy(stmt->error_code, PDO_ERR_NONE);
+
+	if (!S || !S->stmt_handle || S->result_seq != intern->result_seq) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_INVALID_CURSOR_POS, NULL, NULL);
+		goto ERR_LAZY_ROW_VALUE;
+	}
+
+	if (S->scroll_state == CUBRID_SCROLL_LOADED) {
+		scroll_row = S->scroll_row;
+		S->scroll_row = intern->row - 1;
+		ret = cubrid_stmt_col_to_zval(stmt, colno, &intern->values[colno] TSRMLS_CC);
+		S->scroll_row = scroll_row;
+	} else {
+		cur_row = S->cursor_row;
+
+		if (cur_row != intern->row) {
+			if ((cubrid_retval = cci_cursor(S->stmt_handle, intern->row, CCI_CURSOR_FIRST, &error)) < 0 ||
+					(cubrid_retval = cci_fetch(S->stmt_handle, &error)) < 0) {
+				pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
+				goto ERR_LAZY_ROW_VALUE;
+			}
+		}
+
+		ret = cubrid_stmt_col_to_zval(stmt, colno, &intern->values[colno] TSRMLS_CC);
+
+		if (cur_row != intern->row && cur_row > 0) {
+			if ((cubrid_retval = cci_cursor(S->stmt_handle, cur_row, CCI_CURSOR_FIRST, &error)) < 0 ||
+					(cubrid_retval = cci_fetch(S->stmt_handle, &error)) < 0) {
+				if (ret == SUCCESS) {
+					zval_ptr_dtor(&intern->values[colno]);
+				}
+				ZVAL_UNDEF(&intern->values[colno]);
+				pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
+				goto ERR_LAZY_ROW_VALUE;
+			}
+		}
+	}
+
+	if (ret == FAILURE) {
+		ZVAL_UNDEF(&intern->values[colno]);
+		goto ERR_LAZY_ROW_VALUE;
+	}
+
+	return &intern->values[colno];
+
+ERR_LAZY_ROW_VALUE:
+	pdo_handle_error(stmt->dbh, stmt);
+
+	return NULL;
+}
+
+static void cubrid_lazy_row_get(INTERNAL_FUNCTION_PARAMETERS)
+{
+	cubrid_lazy_row_obj *intern;
+	zval *offset, *value;
+	int colno;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &offset) == FAILURE) {
+		return;
+	}
+
+	intern = Z_CUBRID_LAZY_ROW_P(getThis());
+
+	if ((colno = cubrid_lazy_row_colno(intern, offset)) < 0) {
+		RETURN_NULL();
+	}
+
+	if ((value = cubrid_lazy_row_value(intern, colno TSRMLS_CC)) == NULL) {
+		RETURN_FALSE;
+	}
+
+	ZVAL_COPY(return_value, value);
+}
+
+static void cubrid_lazy_row_isset(INTERNAL_FUNCTION_PARAMETERS)
+{
+	cubrid_lazy_row_obj *intern;
+	zval *offset, *value;
+	int colno;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &offset) == FAILURE) {
+		return;
+	}
+
+	intern = Z_CUBRID_LAZY_ROW_P(getThis());
+
+	if ((colno = cubrid_lazy_row_colno(intern, offset)) < 0) {
+		RETURN_FALSE;
+	}
+
+	value = cubrid_lazy_row_value(intern, colno TSRMLS_CC);
+
+	RETURN_BOOL(value && Z_TYPE_P(value) != IS_NULL);
+}
+
+static PHP_METHOD(PDOCubridLazyRow, offsetGet)
+{
+	cubrid_lazy_row_get(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(PDOCubridLazyRow, offsetExists)
+{
+	cubrid_lazy_row_isset(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(PDOCubridLazyRow, offsetSet)
+{
+	zend_throw_exception_ex(php_pdo_get_exception(), 0, "Cannot modify a PDOCubridLazyRow");
+}
+
+static PHP_METHOD(PDOCubridLazyRow, offsetUnset)
+{
+	zend_throw_exception_ex(php_pdo_get_exception(), 0, "Cannot modify a PDOCubridLazyRow");
+}
+
+static PHP_METHOD(PDOCubridLazyRow, __get)
+{
+	cubrid_lazy_row_get(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(PDOCubridLazyRow, __isset)
+{
+	cubrid_lazy_row_isset(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(PDOCubridLazyRow, toArray)
+{
+	cubrid_lazy_row_obj *intern;
+	pdo_stmt_t *stmt;
+	zval *value;
+	int i;
+
+	if (zend_parse_parameters_none() == FAILURE) {
+		return;
+	}
+
+	intern = Z_CUBRID_LAZY_ROW_P(getThis());
+	stmt = Z_PDO_STMT_P(&intern->stmt);
+
+	if (!stmt->columns || stmt->column_count < intern->col_count) {
+		RETURN_FALSE;
+	}
+
+	array_init_size(return_value, intern->col_count);
+
+	for (i = 0; i < intern->col_count; i++) {
+		if ((value = cubrid_lazy_row_value(intern, i TSRMLS_CC)) == NULL) {
+			zval_ptr_dtor(return_value);
+			RETURN_FALSE;
+		}
+
+		Z_TRY_ADDREF_P(value);
+		zend_symtable_update(Z_ARRVAL_P(return_value), stmt->columns[i].name, value);
+	}
+}
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_cubrid_lazy_row_offset, 0, 0, 1)
+	ZEND_ARG_INFO(0, offset)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_cubrid_lazy_row_offset_value, 0, 0, 2)
+	ZEND_ARG_INFO(0, offset)
+	ZEND_ARG_INFO(0, value)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_cubrid_lazy_row_name, 0, 0, 1)
+	ZEND_ARG_INFO(0, name)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO(arginfo_cubrid_lazy_row_void, 0)
+ZEND_END_ARG_INFO()
+
+static const zend_function_entry cubrid_lazy_row_methods[] = {
+	PHP_ME(PDOCubridLazyRow, offsetGet, arginfo_cubrid_lazy_row_offset, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyRow, offsetExists, arginfo_cubrid_lazy_row_offset, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyRow, offsetSet, arginfo_cubrid_lazy_row_offset_value, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyRow, offsetUnset, arginfo_cubrid_lazy_row_offset, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyRow, __get, arginfo_cubrid_lazy_row_name, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyRow, __isset, arginfo_cubrid_lazy_row_name, ZEND_ACC_PUBLIC)
+	PHP_ME(PDOCubridLazyRow, toArray, arginfo_cubrid_lazy_row_void, ZEND_ACC_PUBLIC)
+	{NULL, NULL, NULL}
+};
+
+void pdo_cubrid_lazy_row_minit(TSRMLS_D)
+{
+	zend_class_entry ce;
+
+	INIT_CLASS_ENTRY(ce, "PDOCubridLazyRow", cubrid_lazy_row_methods);
+	cubrid_lazy_row_ce = zend_register_internal_class(&ce TSRMLS_CC);
+	cubrid_lazy_row_ce->ce_flags |= ZEND_ACC_FINAL;
+	cubrid_lazy_row_ce->create_object = cubrid_lazy_row_create;
+	zend_class_implements(cubrid_lazy_row_ce TSRMLS_CC, 1, zend_ce_arrayaccess);
+
+	memcpy(&cubrid_lazy_row_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+	cubrid_lazy_row_handlers.offset = XtOffsetOf(cubrid_lazy_row_obj, std);
+	cubrid_lazy_row_handlers.free_obj = cubrid_lazy_row_free;
+	cubrid_lazy_row_handlers.clone_obj = NULL;
+}
+
+/************************************************************************
+* PRIVATE FUNCTIONS IMPLEMENTATION
+************************************************************************/
+
+/* Move to the next row, returns 1 on success, 0 at the end and -1 on error */
+static int cubrid_stmt_fetch_next(pdo_stmt_t *stmt TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	T_CCI_ERROR error;
+
+	if (S->scroll_state == CUBRID_SCROLL_LOADED) {
+		return cubrid_scroll_buffer_fetch(S, PDO_FETCH_ORI_NEXT, 0);
+	}
+
+	if (S->fetch_size == CUBRID_FETCH_SIZE_ADAPTIVE) {
+		cubrid_adapt_fetch_size(S, PDO_FETCH_ORI_NEXT, S->cursor_pos + 1);
+	}
+
+	cubrid_retval = cci_cursor(S->stmt_handle, 1, CCI_CURSOR_CURRENT, &error);
+	if (cubrid_retval == CCI_ER_NO_MORE_DATA) {
+		return 0;
+	}
+
+	if (cubrid_retval < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
+		return -1;
+	}
+
+	S->cursor_pos++;
+	S->cursor_row++;
+
+	if ((cubrid_retval = cci_fetch(S->stmt_handle, &error)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
+		return -1;
+	}
+
+	return 1;
+}
+
+static int cubrid_stmt_numeric_to_zval(pdo_stmt_t *stmt, int colno, T_CCI_U_TYPE type, zval *dest TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	int cubrid_retval = 0;
+	int ind = 0;
+
+	int int_val = 0;
+	CUBRID_LONG_LONG bigint_val = 0;
+	double double_val = 0;
+
+	switch (type) {
+	case CCI_U_TYPE_INT:
+	case CCI_U_TYPE_SHORT:
+		cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_INT, &int_val, &ind);
+		ZVAL_LONG(dest, int_val);
+		break;
+	case CCI_U_TYPE_BIGINT:
+		cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_BIGINT, &bigint_val, &ind);
+		ZVAL_LONG(dest, (zend_long)bigint_val);
+		break;
+	default:
+		cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_DOUBLE, &double_val, &ind);
+		ZVAL_DOUBLE(dest, double_val);
+		break;
+	}
+
+	if (cubrid_retval < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return FAILURE;
+	}
+
+	if (ind < 0) {
+		ZVAL_NULL(dest);
+	}
+
+	return SUCCESS;
+}
+
+/* Decode a SET/MULTISET/SEQUENCE value into a list, elements keep their CUBRID type */
+static int cubrid_stmt_set_to_zval(pdo_stmt_t *stmt, int colno, zval *dest TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	T_CCI_SET set = NULL;
+	T_CCI_U_TYPE elem_type;
+	int cubrid_retval = 0;
+	int ind = 0;
+	int set_size, i;
+
+	int int_val = 0;
+	CUBRID_LONG_LONG bigint_val = 0;
+	double double_val = 0;
+	char *str_val = NULL;
+
+	zval elem;
+
+	if ((cubrid_retval = cci_get_data(S->stmt_handle, colno + 1, CCI_A_TYPE_SET, &set, &ind)) < 0) {
+		pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+		return FAILURE;
+	}
+
+	if (ind < 0) {
+		ZVAL_NULL(dest);
+		return SUCCESS;
+	}
+
+	set_size = cci_set_size(set);
+	elem_type = stmt->dbh->stringify ? CCI_U_TYPE_STRING : cci_set_element_type(set);
+
+	array_init_size(dest, set_size);
+
+	for (i = 1; i <= set_size; i++) {
+		switch (elem_type) {
+		case CCI_U_TYPE_INT:
+		case CCI_U_TYPE_SHORT:
+			cubrid_retval = cci_set_get(set, i, CCI_A_TYPE_INT, &int_val, &ind);
+			ZVAL_LONG(&elem, int_val);
+			break;
+#if SIZEOF_ZEND_LONG >= 8
+		case CCI_U_TYPE_BIGINT:
+			cubrid_retval = cci_set_get(set, i, CCI_A_TYPE_BIGINT, &bigint_val, &ind);
+			ZVAL_LONG(&elem, (zend_long)bigint_val);
+			break;
+#endif
+		case CCI_U_TYPE_FLOAT:
+		case CCI_U_TYPE_DOUBLE:
+		case CCI_U_TYPE_MONETARY:
+			cubrid_retval = cci_set_get(set, i, CCI_A_TYPE_DOUBLE, &double_val, &ind);
+			ZVAL_DOUBLE(&elem, double_val);
+			break;
+		default:
+			/* the element points into the set buffer, it is copied once into the zend_string */
+			cubrid_retval = cci_set_get(set, i, CCI_A_TYPE_STR, &str_val, &ind);
+			if (cubrid_retval >= 0 && ind >= 0) {
+				ZVAL_STRINGL(&elem, str_val, ind);
+			}
+			break;
+		}
+
+		if (cubrid_retval < 0) {
+			zval_ptr_dtor(dest);
+			cci_set_free(set);
+			pdo_cubrid_error_stmt(stmt, cubrid_retval, NULL, NULL);
+			return FAILURE;
+		}
+
+		if (ind < 0) {
+			ZVAL_NULL(&elem);
+		}
+
+		zend_hash_next_index_insert_new(Z_ARRVAL_P(dest), &elem);
+	}
+
+	cci_set_free(set);
+
+	return SUCCESS;
+}
+
+/* Exact conversion of a NUMERIC text to an integer in units of 10^-scale, e.g. cents for scale 2 */
+static int cubrid_numeric_to_scaled(const char *str, int scale, zend_long *result)
+{
+	zend_ulong acc = 0;
+	zend_ulong limit;
+	int negative = 0;
+	int frac_digits = -1;
+	int digit;
+
+	if (*str == '-' || *str == '+') {
+		negative = (*str == '-');
+		str++;
+	}
+
+	limit = negative ? (zend_ulong)ZEND_LONG_MAX + 1 : (zend_ulong)ZEND_LONG_MAX;
+
+	for (; *str; str++) {
+		if (*str == '.') {
+			frac_digits = 0;
+			continue;
+		}
+
+		if (*str < '0' || *str > '9') {
+			return FAILURE;
+		}
+
+		if (frac_digits >= 0) {
+			/* digits past the declared scale can not be represented */
+			if (frac_digits == scale) {
+				break;
+			}
+			frac_digits++;
+		}
+
+		digit = *str - '0';
+		if (acc > (limit - digit) / 10) {
+			return FAILURE;
+		}
+		acc = acc * 10 + digit;
+	}
+
+	for (frac_digits = frac_digits < 0 ? 0 : frac_digits; frac_digits < scale; frac_digits++) {
+		if (acc > limit / 10) {
+			return FAILURE;
+		}
+		acc *= 10;
+	}
+
+	*result = negative ? (zend_long)(0 - acc) : (zend_long)acc;
+
+	return SUCCESS;
+}
+
+/* The string all repeats of a value in a column share, NULL if the value is not shared */
+static zend_string *cubrid_dedup_string(pdo_cubrid_stmt *S, int colno, const char *str, size_t len)
+{
+	pdo_cubrid_col_desc *desc;
+	zval *entry, tmp;
+
+	if (!S->col_desc || colno >= S->col_desc_count) {
+		return NULL;
+	}
+
+	desc = &S->col_desc[colno];
+	if (desc->dedup_off || len > CUBRID_DEDUP_MAX_LEN) {
+		return NULL;
+	}
+
+	if (!desc->dedup_map) {
+		ALLOC_HASHTABLE(desc->dedup_map);
+		zend_hash_init(desc->dedup_map, 16, NULL, ZVAL_PTR_DTOR, 0);
+	}
+
+	desc->dedup_lookups++;
+
+	if ((entry = zend_hash_str_find(desc->dedup_map, str, len)) != NULL) {
+		desc->dedup_hits++;
+		return Z_STR_P(entry);
+	}
+
+	if (zend_hash_num_elements(desc->dedup_map) >= CUBRID_DEDUP_MAX_VALUES ||
+			(desc->dedup_lookups >= CUBRID_DEDUP_SAMPLE && desc->dedup_hits * 2 < desc->dedup_lookups)) {
+		/* a high-cardinality column, lookups would cost more than the copies they save */
+		cubrid_dedup_reset(desc);
+		desc->dedup_off = 1;
+		return NULL;
+	}
+
+	ZVAL_STRINGL(&tmp, str, len);
+	zend_hash_add_new(desc->dedup_map, Z_STR(tmp), &tmp);
+
+	return Z_STR(tmp);
+}
+
+static void cubrid_dedup_reset(pdo_cubrid_col_desc *desc)
+{
+	if (desc->dedup_map) {
+		zend_hash_destroy(desc->dedup_map);
+		FREE_HASHTABLE(desc->dedup_map);
+		desc->dedup_map = NULL;
+	}
+
+	desc->dedup_lookups = 0;
+	desc->dedup_hits = 0;
+	desc->dedup_off = 0;
+}
+
+/* The string every row of the statement gets for an ENUM label, made when the label is first seen */
+static zend_string *cubrid_enum_shared_label(pdo_cubrid_col_desc *desc, const char *label, size_t len)
+{
+	zval *entry, tmp;
+
+	if (!desc->enum_map) {
+		ALLOC_HASHTABLE(desc->enum_map);
+		zend_hash_init(desc->enum_map, 8, NULL, ZVAL_PTR_DTOR, 0);
+	}
+
+	if ((entry = zend_hash_str_find(desc->enum_map, label, len)) != NULL) {
+		return Z_STR_P(entry);
+	}
+
+	/* the key and the value are the same string */
+	ZVAL_STRINGL(&tmp, label, len);
+	zend_hash_add_new(desc->enum_map, Z_STR(tmp), &tmp);
+
+	return Z_STR(tmp);
+}
+
+/* 1-based position of an ENUM label in the column definition, what CAST(col AS INT) gives */
+static int cubrid_enum_ordinal(pdo_stmt_t *stmt, int colno, const char *label, size_t len, zend_long *ordinal TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	pdo_cubrid_col_desc *desc;
+
+	T_CCI_ERROR error;
+	int cubrid_retval = 0;
+	zend_ulong idx;
+	zval *entry, tmp;
+
+	if ((!S->col_desc && cubrid_build_col_desc(stmt TSRMLS_CC) != SUCCESS) || colno >= S->col_desc_count) {
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL, NULL);
+		return FAILURE;
+	}
+
+	desc = &S->col_desc[colno];
+
+	if (!desc->enum_map) {
+		if ((cubrid_retval = cubrid_enum_load_labels(stmt, colno, &error TSRMLS_CC)) < 0) {
+			pdo_cubrid_error_stmt(stmt, cubrid_retval, &error, NULL);
+			return FAILURE;
+		}
+
+		ALLOC_HASHTABLE(desc->enum_map);
+		zend_hash_init(desc->enum_map, zend_hash_num_elements(Z_ARRVAL(desc->enum_labels)), NULL, NULL, 0);
+
+		ZEND_HASH_FOREACH_NUM_KEY_VAL(Z_ARRVAL(desc->enum_labels), idx, entry) {
+			ZVAL_LONG(&tmp, (zend_long)idx + 1);
+			zend_hash_update(desc->enum_map, Z_STR_P(entry), &tmp);
+		} ZEND_HASH_FOREACH_END();
+	}
+
+	if ((entry = zend_hash_str_find(desc->enum_map, label, len)) == NULL) {
+		/* the column definition changed after the statement read it */
+		pdo_cubrid_error_stmt(stmt, CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL, NULL);
+		return FAILURE;
+	}
+
+	*ordinal = Z_LVAL_P(entry);
+
+	return SUCCESS;
+}
+
+/* Read the labels of an ENUM column into desc->enum_labels with SHOW COLUMNS on its table,
+ * once for the statement. Returns a CCI error code when the column has no table or the query fails. */
+static int cubrid_enum_load_labels(pdo_stmt_t *stmt, int colno, T_CCI_ERROR *error TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	pdo_cubrid_col_desc *desc = &S->col_desc[colno];
+
+	char *class_name, *attr_name, *dot, *field = NULL, *type = NULL;
+	char sql[1024];
+	int sql_len;
+	int request_handle = 0;
+	int cubrid_retval = 0;
+	int ind;
+
+	error->err_code = 0;
+	error->err_msg[0] = '\0';
+
+	if (Z_TYPE(desc->enum_labels) == IS_ARRAY) {
+		return 0;
+	}
+
+	class_name = S->col_info[colno].class_name;
+	attr_name = S->col_info[colno].real_attr;
+	if (!class_name || !*class_name || !attr_name || !*attr_name || strchr(class_name, '`')) {
+		return CUBRID_ER_CANNOT_GET_COLUMN_INFO;
+	}
+
+	/* "owner.table" from CUBRID 11.2 on */
+	if ((dot = strchr(class_name, '.')) != NULL) {
+		sql_len = snprintf(sql, sizeof(sql), "SHOW COLUMNS FROM `%.*s`.`%s`", 
+				(int)(dot - class_name), class_name, dot + 1);
+	} else {
+		sql_len = snprintf(sql, sizeof(sql), "SHOW COLUMNS FROM `%s`", class_name);
+	}
+
+	if (sql_len < 0 || sql_len >= (int)sizeof(sql)) {
+		return CUBRID_ER_CANNOT_GET_COLUMN_INFO;
+	}
+
+	if ((request_handle = cci_prepare(S->H->conn_handle, sql, 0, error)) < 0) {
+		return request_handle;
+	}
+
+	if ((cubrid_retval = cci_execute(request_handle, 0, 0, error)) < 0) {
+		goto ERR_ENUM_LOAD_LABELS;
+	}
+
+	while (1) {
+		cubrid_retval = cci_cursor(request_handle, 1, CCI_CURSOR_CURRENT, error);
+		if (cubrid_retval == CCI_ER_NO_MORE_DATA) {
+			cubrid_retval = CUBRID_ER_CANNOT_GET_COLUMN_INFO;
+			goto ERR_ENUM_LOAD_LABELS;
+		}
+
+		if (cubrid_retval < 0) {
+			goto ERR_ENUM_LOAD_LABELS;
+		}
+
+		if ((cubrid_retval = cci_fetch(request_handle, error)) < 0) {
+			goto ERR_ENUM_LOAD_LABELS;
+		}
+
+		/* Field, Type, Null, Key, Default, Extra */
+		if ((cubrid_retval = cci_get_data(request_handle, 1, CCI_A_TYPE_STR, &field, &ind)) < 0) {
+			goto ERR_ENUM_LOAD_LABELS;
+		}
+
+		if (ind >= 0 && strcasecmp(field, attr_name) == 0) {
+			break;
+		}
+	}
+
+	if ((cubrid_retval = cci_get_data(request_handle, 2, CCI_A_TYPE_STR, &type, &ind)) < 0) {
+		goto ERR_ENUM_LOAD_LABELS;
+	}
+
+	if (ind < 0 || cubrid_enum_parse_labels(type, &desc->enum_labels) == FAILURE) {
+		cubrid_retval = CUBRID_ER_CANNOT_GET_COLUMN_INFO;
+		goto ERR_ENUM_LOAD_LABELS;
+	}
+
+	cci_close_req_handle(request_handle);
+
+	return 0;
+
+ERR_ENUM_LOAD_LABELS:
+	cci_close_req_handle(request_handle);
+
+	return cubrid_retval;
+}
+
+/* Labels of a type as SHOW COLUMNS prints it, "ENUM('a', 'b')", where '' stands for a quote in a label */
+static int cubrid_enum_parse_labels(const char *type, zval *labels)
+{
+	const char *p;
+	char *buf;
+	size_t len;
+
+	if (strncasecmp(type, "ENUM(", sizeof("ENUM(") - 1) != 0) {
+		return FAILURE;
+	}
+
+	buf = emalloc(strlen(type) + 1);
+	array_init(labels);
+
+	for (p = type + sizeof("ENUM(") - 1; *p && *p != ')'; p++) {
+		if (*p != '\'') {
+			continue;
+		}
+
+		for (len = 0, p++; *p; p++) {
+			if (*p == '\'') {
+				if (p[1] != '\'') {
+					break;
+				}
+				p++;
+			}
+			buf[len++] = *p;
+		}
+
+		if (!*p) {
+			break;
+		}
+
+		add_next_index_stringl(labels, buf, len);
+	}
+
+	efree(buf);
+
+	if (*p != ')') {
+		zval_ptr_dtor(labels);
+		ZVAL_UNDEF(labels);
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/* Same conversion PDO core applies to the get_col_data result */
+static int cubrid_stmt_col_to_zval(pdo_stmt_t *stmt, int colno, zval *dest TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	struct pdo_column_data *col = &stmt->columns[colno];
+
+	char *value = NULL;
+	unsigned long value_len = 0;
+	int caller_frees = 0;
+	zend_string *buf;
+
+	cubrid_stmt_get_col_data(stmt, colno, &value, &value_len, &caller_frees TSRMLS_CC);
+	if (!value && strcmp(stmt->error_code, PDO_ERR_NONE) != 0) {
+		return FAILURE;
+	}
+
+	switch (PDO_PARAM_TYPE(col->param_type)) {
+	case PDO_PARAM_ZVAL:
+		if (value && value_len == sizeof(zval)) {
+			ZVAL_COPY_VALUE(dest, (zval *)value);
+		} else {
+			ZVAL_NULL(dest);
+		}
+		break;
+	case PDO_PARAM_INT:
+		if (value && value_len == sizeof(zend_long)) {
+			ZVAL_LONG(dest, *(zend_long *)value);
+		} else {
+			ZVAL_NULL(dest);
+		}
+		break;
+	case PDO_PARAM_LOB:
+		if (!value) {
+			ZVAL_NULL(dest);
+		} else if (stmt->dbh->stringify) {
+			if ((buf = php_stream_copy_to_mem((php_stream *)value, PHP_STREAM_COPY_ALL, 0)) != NULL) {
+				ZVAL_STR(dest, buf);
+			} else {
+				ZVAL_EMPTY_STRING(dest);
+			}
+			php_stream_close((php_stream *)value);
+		} else {
+			php_stream_to_zval((php_stream *)value, dest);
+		}
+		break;
+	default:
+		if (!value || (value_len == 0 && stmt->dbh->oracle_nulls == PDO_NULL_EMPTY_STRING)) {
+			ZVAL_NULL(dest);
+		} else if (CCI_GET_RESULT_INFO_TYPE(S->col_info, colno + 1) == CCI_U_TYPE_ENUM && 
+				S->col_desc && colno < S->col_desc_count) {
+			/* rows of the driver fetch methods share the label strings of the column */
+			ZVAL_STR_COPY(dest, cubrid_enum_shared_label(&S->col_desc[colno], value, value_len));
+		} else {
+			ZVAL_STRINGL(dest, value, value_len);
+		}
+		break;
+	}
+
+	if (caller_frees && value) {
+		efree(value);
+	}
+
+	if (stmt->dbh->stringify && (Z_TYPE_P(dest) == IS_LONG || Z_TYPE_P(dest) == IS_DOUBLE)) {
+		convert_to_string(dest);
+	}
+
+	if (Z_TYPE_P(dest) == IS_NULL && stmt->dbh->oracle_nulls == PDO_NULL_TO_STRING) {
+		ZVAL_EMPTY_STRING(dest);
+	}
+
+	return SUCCESS;
+}
+
+/* Same result as cubrid_stmt_col_to_zval followed by the conversion PDO applies to a column bound
+ * with type, but written over what dest already holds: a string only dest references is resized
+ * in place and a number is stored over the old value, so a FETCH_BOUND loop allocates nothing */
+static int cubrid_stmt_col_to_bound(pdo_stmt_t *stmt, int colno, zval *dest, int type TSRMLS_DC)
+{
+	struct pdo_column_data *col = &stmt->columns[colno];
+
+	char *value = NULL;
+	unsigned long value_len = 0;
+	int caller_frees = 0;
+	zend_string *str;
+
+	if (PDO_PARAM_TYPE(col->param_type) == PDO_PARAM_STR && type == PDO_PARAM_STR) {
+		cubrid_stmt_get_col_data(stmt, colno, &value, &value_len, &caller_frees TSRMLS_CC);
+		if (!value && strcmp(stmt->error_code, PDO_ERR_NONE) != 0) {
+			return FAILURE;
+		}
+
+		if (!value || (value_len == 0 && stmt->dbh->oracle_nulls == PDO_NULL_EMPTY_STRING)) {
+			zval_ptr_dtor(dest);
+			if (stmt->dbh->oracle_nulls == PDO_NULL_TO_STRING) {
+				ZVAL_EMPTY_STRING(dest);
+			} else {
+				ZVAL_NULL(dest);
+			}
+		} else if (Z_TYPE_P(dest) == IS_STRING && !ZSTR_IS_INTERNED(Z_STR_P(dest)) && 
+				GC_REFCOUNT(Z_STR_P(dest)) == 1) {
+			str = Z_STR_P(dest);
+			if (ZSTR_LEN(str) != value_len) {
+				/* erealloc keeps the block when the new size is in the same bin */
+				str = zend_string_realloc(str, value_len, 0);
+			}
+
+			memcpy(ZSTR_VAL(str), value, value_len);
+			ZSTR_VAL(str)[value_len] = '\0';
+			zend_string_forget_hash_val(str);
+			ZVAL_STR(dest, str);
+		} else {
+			zval_ptr_dtor(dest);
+			ZVAL_STRINGL(dest, value, value_len);
+		}
+
+		if (caller_frees && value) {
+			efree(value);
+		}
+
+		return SUCCESS;
+	}
+
+	if (PDO_PARAM_TYPE(col->param_type) == PDO_PARAM_INT && type == PDO_PARAM_INT && !stmt->dbh->stringify) {
+		cubrid_stmt_get_col_data(stmt, colno, &value, &value_len, &caller_frees TSRMLS_CC);
+		if (!value && strcmp(stmt->error_code, PDO_ERR_NONE) != 0) {
+			return FAILURE;
+		}
+
+		zval_ptr_dtor(dest);
+
+		if (value && value_len == sizeof(zend_long)) {
+			ZVAL_LONG(dest, *(zend_long *)value);
+		} else if (stmt->dbh->oracle_nulls == PDO_NULL_TO_STRING) {
+			ZVAL_EMPTY_STRING(dest);
+		} else {
+			ZVAL_NULL(dest);
+		}
+
+		return SUCCESS;
+	}
+
+	zval_ptr_dtor(dest);
+
+	if (PDO_PARAM_TYPE(col->param_type) == PDO_PARAM_LOB && type == PDO_PARAM_STR) {
+		/* PDO reads the LOB into a string for a column bound as a string */
+		cubrid_stmt_get_col_data(stmt, colno, &value, &value_len, &caller_frees TSRMLS_CC);
+		if (!value) {
+			ZVAL_NULL(dest);
+		} else {
+			if ((str = php_stream_copy_to_mem((php_stream *)value, PHP_STREAM_COPY_ALL, 0)) != NULL) {
+				ZVAL_STR(dest, str);
+			} else {
+				ZVAL_EMPTY_STRING(dest);
+			}
+			php_stream_close((php_stream *)value);
+		}
+	} else if (cubrid_stmt_col_to_zval(stmt, colno, dest TSRMLS_CC) == FAILURE) {
+		ZVAL_NULL(dest);
+		return FAILURE;
+	}
+
+	if (type != PDO_PARAM_TYPE(col->param_type)) {
+		switch (type) {
+		case PDO_PARAM_INT:
+			convert_to_long(dest);
+			break;
+		case PDO_PARAM_BOOL:
+			convert_to_boolean(dest);
+			break;
+		case PDO_PARAM_STR:
+			if (Z_TYPE_P(dest) != IS_NULL) {
+				convert_to_string(dest);
+			}
+			break;
+		case PDO_PARAM_NULL:
+			convert_to_null(dest);
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (stmt->dbh->stringify && (Z_TYPE_P(dest) == IS_LONG || Z_TYPE_P(dest) == IS_DOUBLE)) {
+		convert_to_string(dest);
+	}
+
+	if (Z_TYPE_P(dest) == IS_NULL && stmt->dbh->oracle_nulls == PDO_NULL_TO_STRING) {
+		ZVAL_EMPTY_STRING(dest);
+	}
+
+	return SUCCESS;
+}
 
-	switch (S->sql_type) {
-    case CUBRID_STMT_SELECT:
-		S->row_count = exec_ret;
-		break;
-    case CUBRID_STMT_INSERT:
-    case CUBRID_STMT_UPDATE:
-    case CUBRID_STMT_DELETE:
-		S->affected_rows = exec_ret;
-		break;
-    case CUBRID_STMT_CALL:
-		S->row_count = exec_ret;
-		break;
-	default:
-		break;
-    }
+static void cubrid_date_to_zval(T_CCI_DATE *date, const char *tz, T_CCI_U_TYPE type, int mode, zval *dest TSRMLS_DC)
+{
+	cubrid_lazy_date_obj *intern;
+
+	if (mode == CUBRID_DATE_LAZY) {
+		object_init_ex(dest, cubrid_lazy_date_ce);
+		intern = Z_CUBRID_LAZY_DATE_P(dest);
+		intern->date = *date;
+		intern->type = type;
+		if (tz) {
+			strlcpy(intern->tz, tz, sizeof(intern->tz));
+		}
+	} else {
+		cubrid_date_to_datetime(date, tz, type, dest TSRMLS_CC);
+	}
+}
 
-	S->cursor_pos = 1;
+/* Build the DateTimeImmutable straight from the CCI fields, in tz if given or else in the default timezone */
+static void cubrid_date_to_datetime(T_CCI_DATE *date, const char *tz, T_CCI_U_TYPE type, zval *dest TSRMLS_DC)
+{
+	php_date_obj *dateobj;
+	timelib_time *t;
+	timelib_tzinfo *tzi;
+	long us = 0;
+
+	char buf[64 + MAX_LEN_TZ];
+	int len;
+
+	if (tz && *tz) {
+		/* tz is a region with an optional abbreviation or an offset, ext/date resolves either */
+		len = snprintf(buf, sizeof(buf), "%04d-%02d-%02d %02d:%02d:%02d.%03d %.*s",
+				date->yr, date->mon, date->day, date->hh, date->mm, date->ss,
+				type == CCI_U_TYPE_DATETIME ? date->ms : 0, (int)strcspn(tz, " "), tz);
+
+		php_date_instantiate(php_date_get_immutable_ce(), dest TSRMLS_CC);
+		if (php_date_initialize(Z_PHPDATE_P(dest), buf, len, NULL, NULL, 0 TSRMLS_CC)) {
+			return;
+		}
 
-	return 1;
+		zval_ptr_dtor(dest);
+	}
+
+	php_date_instantiate(php_date_get_immutable_ce(), dest TSRMLS_CC);
+	dateobj = Z_PHPDATE_P(dest);
+
+	tzi = get_timezone_info(TSRMLS_C);
+	t = timelib_time_ctor();
+	t->tz_info = tzi;
+	t->zone_type = TIMELIB_ZONETYPE_ID;
+
+	if (type == CCI_U_TYPE_TIME) {
+		t->y = 1970;
+		t->m = 1;
+		t->d = 1;
+	} else {
+		t->y = date->yr;
+		t->m = date->mon;
+		t->d = date->day;
+	}
+
+	if (type != CCI_U_TYPE_DATE) {
+		t->h = date->hh;
+		t->i = date->mm;
+		t->s = date->ss;
+	}
+
+	if (type == CCI_U_TYPE_DATETIME) {
+		us = date->ms * 1000;
+	}
+
+#if PHP_VERSION_ID >= 70100
+	t->us = us;
+#else
+	t->f = us / 1000000.0;
+#endif
+
+	timelib_update_ts(t, tzi);
+	timelib_update_from_sse(t);
+	t->is_localtime = 1;
+	t->have_relative = 0;
+
+	dateobj->time = t;
 }
 
-struct pdo_stmt_methods cubrid_stmt_methods = {
-    cubrid_stmt_dtor, 
-	cubrid_stmt_execute, 
-	cubrid_stmt_fetch, 
-	cubrid_stmt_describe_col, 
-	cubrid_stmt_get_col_data, 
-	cubrid_stmt_param_hook, 
-	NULL, /* set attr */
-	NULL, /* get attr */
-    cubrid_stmt_get_column_meta, /* get column meta */
-	cubrid_stmt_next_rowset,
-	NULL, /* cursor closer */
-};
+/* Same text CCI_A_TYPE_STR gives for the type */
+static int cubrid_date_to_str(T_CCI_DATE *date, const char *tz, T_CCI_U_TYPE type, char *buf, int buf_len)
+{
+	if (tz && *tz) {
+		if (type == CCI_U_TYPE_TIMESTAMP) {
+			return snprintf(buf, buf_len, "%04d-%02d-%02d %02d:%02d:%02d %s",
+					date->yr, date->mon, date->day, date->hh, date->mm, date->ss, tz);
+		}
 
-/************************************************************************
-* PRIVATE FUNCTIONS IMPLEMENTATION
-************************************************************************/
+		return snprintf(buf, buf_len, "%04d-%02d-%02d %02d:%02d:%02d.%03d %s",
+				date->yr, date->mon, date->day, date->hh, date->mm, date->ss, date->ms, tz);
+	}
+
+	switch (type) {
+	case CCI_U_TYPE_DATE:
+		return snprintf(buf, buf_len, "%04d-%02d-%02d", date->yr, date->mon, date->day);
+	case CCI_U_TYPE_TIME:
+		return snprintf(buf, buf_len, "%02d:%02d:%02d", date->hh, date->mm, date->ss);
+	case CCI_U_TYPE_TIMESTAMP:
+		return snprintf(buf, buf_len, "%04d-%02d-%02d %02d:%02d:%02d",
+				date->yr, date->mon, date->day, date->hh, date->mm, date->ss);
+	default:
+		return snprintf(buf, buf_len, "%04d-%02d-%02d %02d:%02d:%02d.%03d",
+				date->yr, date->mon, date->day, date->hh, date->mm, date->ss, date->ms);
+	}
+}
 
 static int get_cubrid_u_type_by_name(const char *type_name)
 {
@@ -1128,6 +4128,427 @@ static int get_cubrid_u_type_len(T_CCI_U_TYPE type)
     return 0;
 }
 
+/* The PDO column type used for a CCI type when native typed fetch is enabled */
+static int get_cubrid_native_param_type(T_CCI_U_TYPE type)
+{
+	switch (type) {
+	case CCI_U_TYPE_INT:
+	case CCI_U_TYPE_SHORT:
+#if SIZEOF_ZEND_LONG >= 8
+	case CCI_U_TYPE_BIGINT:
+#endif
+		return PDO_PARAM_INT;
+#if PDO_DRIVER_API >= 20080721
+	case CCI_U_TYPE_FLOAT:
+	case CCI_U_TYPE_DOUBLE:
+	case CCI_U_TYPE_MONETARY:
+		return PDO_PARAM_ZVAL;
+#endif
+	default:
+		return PDO_PARAM_STR;
+	}
+}
+
+/* Describe all columns of the current result once, cubrid_stmt_describe_col hands out copies */
+static int cubrid_build_col_desc(pdo_stmt_t *stmt TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	pdo_cubrid_col_desc *desc;
+
+	T_CCI_U_TYPE ext_type, type;
+	long type_maxlen;
+	char *str;
+	int i;
+
+	if (S->col_count <= 0) {
+		return FAILURE;
+	}
+
+	S->col_desc = (pdo_cubrid_col_desc *) safe_emalloc(S->col_count, sizeof(pdo_cubrid_col_desc), 0);
+	S->col_desc_count = S->col_count;
+	S->col_desc_flags = CUBRID_COL_DESC_FLAGS(S, stmt->dbh);
+
+	for (i = 0; i < S->col_count; i++) {
+		desc = &S->col_desc[i];
+
+		str = CCI_GET_RESULT_INFO_NAME(S->col_info, i + 1);
+		desc->name = zend_string_init(str, strlen(str), 0);
+		desc->enum_map = NULL;
+		ZVAL_UNDEF(&desc->enum_labels);
+		desc->dedup_map = NULL;
+		cubrid_dedup_reset(desc);
+		desc->precision = CCI_GET_RESULT_INFO_PRECISION(S->col_info, i + 1);
+
+		ext_type = CCI_GET_RESULT_INFO_TYPE(S->col_info, i + 1);
+		type = CCI_GET_COLLECTION_DOMAIN(ext_type);
+		desc->ext_type = ext_type;
+		if ((type_maxlen = get_cubrid_u_type_len(type)) == -1) {
+			type_maxlen = desc->precision;
+			if (type == CCI_U_TYPE_NUMERIC) {
+				type_maxlen += 2; /* "," + "-" */
+			}
+		}
+
+		if (CCI_IS_COLLECTION_TYPE(ext_type)) {
+			type_maxlen = MAX_LEN_SET;
+		}
+
+		desc->maxlen = type_maxlen;
+
+#if PDO_DRIVER_API >= 20080721
+		if ((type == CCI_U_TYPE_BLOB || type == CCI_U_TYPE_CLOB) && S->lob_inline_size > 0) {
+			/* a string or a stream depending on the size of each value */
+			desc->param_type = PDO_PARAM_ZVAL;
+		} else
+#endif
+		if (type == CCI_U_TYPE_BLOB || type == CCI_U_TYPE_CLOB) {
+			desc->param_type = PDO_PARAM_LOB;
+		} else if (CCI_IS_COLLECTION_TYPE(ext_type)) {
+			desc->param_type = S->fetch_collections ? PDO_PARAM_ZVAL : PDO_PARAM_STR;
+		} else if (S->numeric_mode == CUBRID_NUMERIC_SCALED && type == CCI_U_TYPE_NUMERIC) {
+			desc->param_type = PDO_PARAM_INT;
+		} else if (S->enum_mode == CUBRID_ENUM_ORDINAL && type == CCI_U_TYPE_ENUM) {
+			desc->param_type = PDO_PARAM_INT;
+#if PDO_DRIVER_API >= 20080721
+		} else if (type == CCI_U_TYPE_ENUM && (S->dedup_strings || CUBRID_SCROLL_BUFFERED(S))) {
+			/* shared or buffered rows hand out the label strings of the column */
+			desc->param_type = PDO_PARAM_ZVAL;
+		} else if (S->numeric_mode == CUBRID_NUMERIC_FLOAT && type == CCI_U_TYPE_NUMERIC) {
+			desc->param_type = PDO_PARAM_ZVAL;
+		} else if (S->fetch_dates != CUBRID_DATE_STRING && (CUBRID_IS_DATE_TYPE(type) || CUBRID_IS_DATE_TZ_TYPE(type))) {
+			desc->param_type = PDO_PARAM_ZVAL;
+		} else if (S->fetch_json && type == CCI_U_TYPE_JSON && CUBRID_JSON_LOADED()) {
+			desc->param_type = PDO_PARAM_ZVAL;
+		} else if (CUBRID_IS_STRING_TYPE(type) && (S->dedup_strings || 
+					(CUBRID_SCROLL_BUFFERED(S) && desc->precision >= CUBRID_LARGE_STRING_PRECISION))) {
+			/* shared or buffered values are handed out as references, PDO_PARAM_STR would copy them */
+			desc->param_type = PDO_PARAM_ZVAL;
+#endif
+		} else if (S->native_types && !stmt->dbh->stringify) {
+			desc->param_type = get_cubrid_native_param_type(type);
+		} else {
+			desc->param_type = PDO_PARAM_STR;
+		}
+	}
+
+	return SUCCESS;
+}
+
+/* Whether a new result has the same columns as the cached description */
+static int cubrid_col_desc_matches(pdo_cubrid_stmt *S, T_CCI_COL_INFO *col_info, int col_count)
+{
+	int i;
+
+	if (!col_info || col_count != S->col_desc_count) {
+		return 0;
+	}
+
+	/* S->col_info may already be released by CCI, compare with the cached copy only */
+	for (i = 1; i <= col_count; i++) {
+		if (CCI_GET_RESULT_INFO_TYPE(col_info, i) != S->col_desc[i - 1].ext_type ||
+				CCI_GET_RESULT_INFO_PRECISION(col_info, i) != S->col_desc[i - 1].precision ||
+				strcmp(CCI_GET_RESULT_INFO_NAME(col_info, i), ZSTR_VAL(S->col_desc[i - 1].name)) != 0) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static void cubrid_free_col_desc(pdo_cubrid_stmt *S)
+{
+	int i;
+
+	if (!S->col_desc) {
+		return;
+	}
+
+	for (i = 0; i < S->col_desc_count; i++) {
+		zend_string_release(S->col_desc[i].name);
+
+		if (S->col_desc[i].enum_map) {
+			zend_hash_destroy(S->col_desc[i].enum_map);
+			FREE_HASHTABLE(S->col_desc[i].enum_map);
+		}
+
+		zval_ptr_dtor(&S->col_desc[i].enum_labels);
+		cubrid_dedup_reset(&S->col_desc[i]);
+	}
+
+	efree(S->col_desc);
+	S->col_desc = NULL;
+	S->col_desc_count = 0;
+}
+
+/* Read the whole result into S->scroll_rows so that scrolling needs no round trip to the CAS.
+ * Results over S->scroll_buffer_size bytes and results with LOB columns stay on the CCI cursor. */
+static int cubrid_scroll_buffer_load(pdo_stmt_t *stmt TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+
+	zval *rows = NULL;
+	T_CCI_U_TYPE type;
+	long capacity = 0, count = 0;
+	size_t used = 0;
+	int cubrid_retval = 0;
+	int i;
+
+	S->scroll_state = CUBRID_SCROLL_UNBUFFERED;
+
+	/* rows already fetched through the CCI cursor can not be served again */
+	if (S->cursor_pos != 1 || S->col_count <= 0 || !stmt->columns) {
+		return SUCCESS;
+	}
+
+	for (i = 0; i < stmt->column_count; i++) {
+		type = CCI_GET_RESULT_INFO_TYPE(S->col_info, i + 1);
+		if (type == CCI_U_TYPE_BLOB || type == CCI_U_TYPE_CLOB) {
+			return SUCCESS;
+		}
+	}
+
+	while ((cubrid_retval = cubrid_stmt_fetch_next(stmt TSRMLS_CC)) > 0) {
+		if (count == capacity) {
+			capacity = capacity ? capacity * 2 : CUBRID_SCROLL_INITIAL_ROWS;
+			rows = (zval *) safe_erealloc(rows, capacity, S->col_count * sizeof(zval), 0);
+		}
+
+		for (i = 0; i < S->col_count; i++) {
+			if (cubrid_stmt_col_to_zval(stmt, i, &rows[count * S->col_count + i] TSRMLS_CC) == FAILURE) {
+				cubrid_retval = -1;
+				break;
+			}
+
+			used += sizeof(zval) + cubrid_zval_size(&rows[count * S->col_count + i]);
+		}
+
+		if (cubrid_retval < 0) {
+			cubrid_free_zvals(rows, count * S->col_count + i);
+			return FAILURE;
+		}
+
+		count++;
+
+		if (used > (size_t)S->scroll_buffer_size) {
+			cubrid_free_zvals(rows, count * S->col_count);
+			return SUCCESS;
+		}
+	}
+
+	if (cubrid_retval < 0) {
+		cubrid_free_zvals(rows, count * S->col_count);
+		return FAILURE;
+	}
+
+	S->scroll_rows = rows;
+	S->scroll_row_count = count;
+	S->scroll_row = -1;
+	S->scroll_state = CUBRID_SCROLL_LOADED;
+
+	return SUCCESS;
+}
+
+static int cubrid_scroll_buffer_fetch(pdo_cubrid_stmt *S, enum pdo_fetch_orientation ori, long offset)
+{
+	long target;
+
+	switch (ori) {
+	case PDO_FETCH_ORI_FIRST:
+		target = 0;
+		break;
+	case PDO_FETCH_ORI_LAST:
+		target = S->scroll_row_count - 1;
+		break;
+	case PDO_FETCH_ORI_NEXT:
+		target = S->scroll_row + 1;
+		break;
+	case PDO_FETCH_ORI_PRIOR:
+		target = S->scroll_row - 1;
+		break;
+	case PDO_FETCH_ORI_ABS:
+		/* same origin as cci_cursor with CCI_CURSOR_FIRST */
+		target = offset - 1;
+		break;
+	case PDO_FETCH_ORI_REL:
+		target = S->scroll_row + offset;
+		break;
+	default:
+		return 0;
+	}
+
+	if (target < 0 || target >= S->scroll_row_count) {
+		return 0;
+	}
+
+	S->scroll_row = target;
+	S->cursor_pos = target + 2;
+	S->cursor_row = target + 1;
+
+	return 1;
+}
+
+static int cubrid_scroll_buffer_get_col_data(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC)
+{
+	pdo_cubrid_stmt *S = (pdo_cubrid_stmt *)stmt->driver_data;
+	zval *value;
+
+	if (S->scroll_row < 0 || S->scroll_row >= S->scroll_row_count) {
+		return 0;
+	}
+
+	value = &S->scroll_rows[S->scroll_row * S->col_count + colno];
+
+	if (Z_TYPE_P(value) == IS_NULL) {
+		*ptr = NULL;
+		*len = 0;
+		return 1;
+	}
+
+	switch (stmt->columns[colno].param_type) {
+	case PDO_PARAM_STR:
+		if (Z_TYPE_P(value) != IS_STRING) {
+			convert_to_string(value);
+		}
+
+		*ptr = Z_STRVAL_P(value);
+		*len = Z_STRLEN_P(value);
+		break;
+	case PDO_PARAM_INT:
+		S->col_long = zval_get_long(value);
+		*ptr = (char *)&S->col_long;
+		*len = sizeof(zend_long);
+		break;
+	default:
+		ZVAL_COPY(&S->col_zval, value);
+		*ptr = (char *)&S->col_zval;
+		*len = sizeof(zval);
+		break;
+	}
+
+	return 1;
+}
+
+static void cubrid_scroll_buffer_free(pdo_cubrid_stmt *S)
+{
+	cubrid_free_zvals(S->scroll_rows, S->scroll_row_count * S->col_count);
+
+	S->scroll_rows = NULL;
+	S->scroll_row_count = 0;
+	S->scroll_row = -1;
+	S->scroll_state = CUBRID_SCROLL_NONE;
+}
+
+static void cubrid_free_zvals(zval *vals, long count)
+{
+	long i;
+
+	if (!vals) {
+		return;
+	}
+
+	for (i = 0; i < count; i++) {
+		zval_ptr_dtor(&vals[i]);
+	}
+
+	efree(vals);
+}
+
+/* Approximate memory held by a fetched value */
+static size_t cubrid_zval_size(zval *zv)
+{
+	zval *elem;
+	size_t size;
+
+	switch (Z_TYPE_P(zv)) {
+	case IS_STRING:
+		return _ZSTR_STRUCT_SIZE(Z_STRLEN_P(zv));
+	case IS_ARRAY:
+		size = sizeof(HashTable) + zend_hash_num_elements(Z_ARRVAL_P(zv)) * sizeof(Bucket);
+		ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(zv), elem) {
+			size += cubrid_zval_size(elem);
+		} ZEND_HASH_FOREACH_END();
+		return size;
+	case IS_OBJECT:
+		return sizeof(zend_object) + sizeof(T_CCI_DATE) + sizeof(zval);
+	default:
+		return 0;
+	}
+}
+
+/* Rough size of one row in the CAS fetch buffer, used to bound the adaptive fetch size */
+static int cubrid_estimate_row_width(pdo_cubrid_stmt *S)
+{
+	T_CCI_U_TYPE type;
+	int width = 0, col_width;
+	int i;
+
+	for (i = 1; i <= S->col_count; i++) {
+		type = CCI_GET_RESULT_INFO_TYPE(S->col_info, i);
+
+		if (CCI_IS_COLLECTION_TYPE(type)) {
+			col_width = CUBRID_FETCH_COL_WIDTH_MAX;
+		} else if ((col_width = get_cubrid_u_type_len(type)) == -1) {
+			col_width = CCI_GET_RESULT_INFO_PRECISION(S->col_info, i);
+		}
+
+		if (col_width <= 0 || col_width > CUBRID_FETCH_COL_WIDTH_MAX) {
+			col_width = CUBRID_FETCH_COL_WIDTH_MAX;
+		}
+
+		width += col_width;
+	}
+
+	return width > 0 ? width : 1;
+}
+
+/* Size the next network fetch by how many rows of the previous one were read with NEXT:
+ * a window read to the end doubles, a window mostly skipped or scrolled over halves */
+static void cubrid_adapt_fetch_size(pdo_cubrid_stmt *S, enum pdo_fetch_orientation ori, long abs_offset)
+{
+	int fetch_size;
+
+	if (abs_offset < 0) {
+		abs_offset = S->row_count;
+	}
+
+	if (S->cur_fetch_size == 0) {
+		S->fetch_size_cap = CUBRID_FETCH_BUF_SIZE / cubrid_estimate_row_width(S);
+		if (S->fetch_size_cap < CUBRID_FETCH_SIZE_DEFAULT) {
+			S->fetch_size_cap = CUBRID_FETCH_SIZE_DEFAULT;
+		} else if (S->fetch_size_cap > CUBRID_FETCH_SIZE_MAX) {
+			S->fetch_size_cap = CUBRID_FETCH_SIZE_MAX;
+		}
+
+		fetch_size = CUBRID_FETCH_SIZE_DEFAULT;
+	} else if (abs_offset > S->fetch_mark - S->cur_fetch_size && abs_offset <= S->fetch_mark) {
+		/* still inside the rows of the current fetch */
+		if (ori == PDO_FETCH_ORI_NEXT) {
+			S->fetch_consumed++;
+		}
+		return;
+	} else if (S->fetch_consumed >= S->cur_fetch_size) {
+		fetch_size = S->cur_fetch_size * 2;
+		if (fetch_size > S->fetch_size_cap) {
+			fetch_size = S->fetch_size_cap;
+		}
+	} else if (S->fetch_consumed * 2 < S->cur_fetch_size) {
+		fetch_size = S->cur_fetch_size / 2;
+		if (fetch_size < CUBRID_FETCH_SIZE_DEFAULT) {
+			fetch_size = CUBRID_FETCH_SIZE_DEFAULT;
+		}
+	} else {
+		fetch_size = S->cur_fetch_size;
+	}
+
+	if (fetch_size != S->cur_fetch_size) {
+		cci_fetch_size(S->stmt_handle, fetch_size);
+		S->cur_fetch_size = fetch_size;
+	}
+
+	S->fetch_mark = abs_offset + fetch_size - 1;
+	S->fetch_consumed = (ori == PDO_FETCH_ORI_NEXT);
+}
+
 struct cubrid_lob_stream_self {
 	pdo_stmt_t *stmt;
 	pdo_cubrid_stmt *S;
@@ -1275,6 +4696,18 @@ static int type2str(T_CCI_COL_INFO * column_info, char *type_name, int type_name
     case CCI_U_TYPE_DATETIME:
 		snprintf(buf, sizeof(buf), "datetime");
 	break;
+    case CCI_U_TYPE_TIMESTAMPTZ:
+		snprintf(buf, sizeof(buf), "timestamptz");
+	break;
+    case CCI_U_TYPE_TIMESTAMPLTZ:
+		snprintf(buf, sizeof(buf), "timestampltz");
+	break;
+    case CCI_U_TYPE_DATETIMETZ:
+		snprintf(buf, sizeof(buf), "datetimetz");
+	break;
+    case CCI_U_TYPE_DATETIMELTZ:
+		snprintf(buf, sizeof(buf), "datetimeltz");
+	break;
     case CCI_U_TYPE_BLOB:
         snprintf(buf, sizeof(buf), "blob");
         break;
@@ -1284,6 +4717,9 @@ static int type2str(T_CCI_COL_INFO * column_info, char *type_name, int type_name
 	case CCI_U_TYPE_ENUM:
 		snprintf(buf, sizeof(buf), "enum");
 		break;
+	case CCI_U_TYPE_JSON:
+		snprintf(buf, sizeof(buf), "json");
+		break;
     default:
 		/* should not enter here */
 		snprintf(buf, sizeof(buf), "[unknown]");
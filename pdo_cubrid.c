@@ -41,6 +41,10 @@ const zend_function_entry pdo_cubrid_functions[] = {
 #if ZEND_MODULE_API_NO >= 20050922
 static const zend_module_dep pdo_cubrid_deps[] = {
 	ZEND_MOD_REQUIRED("pdo")
+#if PHP_MAJOR_VERSION >= 7
+	ZEND_MOD_REQUIRED("date")
+	ZEND_MOD_OPTIONAL("json")
+#endif
 	{NULL, NULL, NULL}
 };
 #endif
@@ -74,6 +78,32 @@ PHP_MINIT_FUNCTION(pdo_cubrid)
 	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_ISOLATION_LEVEL", PDO_CUBRID_ATTR_ISOLATION_LEVEL);
 	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_LOCK_TIMEOUT", PDO_CUBRID_ATTR_LOCK_TIMEOUT);
 	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_MAX_STRING_LENGTH", PDO_CUBRID_ATTR_MAX_STRING_LENGTH);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_NATIVE_TYPES", PDO_CUBRID_ATTR_NATIVE_TYPES);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_FETCH_SIZE", PDO_CUBRID_ATTR_FETCH_SIZE);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_MAX_ROWS", PDO_CUBRID_ATTR_MAX_ROWS);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_FETCH_DATES", PDO_CUBRID_ATTR_FETCH_DATES);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_FETCH_COLLECTIONS", PDO_CUBRID_ATTR_FETCH_COLLECTIONS);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_SCROLL_BUFFER_SIZE", PDO_CUBRID_ATTR_SCROLL_BUFFER_SIZE);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_NUMERIC_MODE", PDO_CUBRID_ATTR_NUMERIC_MODE);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_BIT_BINARY", PDO_CUBRID_ATTR_BIT_BINARY);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_FETCH_JSON", PDO_CUBRID_ATTR_FETCH_JSON);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_ENUM_MODE", PDO_CUBRID_ATTR_ENUM_MODE);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_DEDUP_STRINGS", PDO_CUBRID_ATTR_DEDUP_STRINGS);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_LOB_INLINE_SIZE", PDO_CUBRID_ATTR_LOB_INLINE_SIZE);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ATTR_STMT_CACHE_SIZE", PDO_CUBRID_ATTR_STMT_CACHE_SIZE);
+
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_FETCH_SIZE_ADAPTIVE", CUBRID_FETCH_SIZE_ADAPTIVE);
+
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_DATE_STRING", CUBRID_DATE_STRING);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_DATE_OBJECT", CUBRID_DATE_OBJECT);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_DATE_LAZY", CUBRID_DATE_LAZY);
+
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_NUMERIC_STRING", CUBRID_NUMERIC_STRING);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_NUMERIC_FLOAT", CUBRID_NUMERIC_FLOAT);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_NUMERIC_SCALED", CUBRID_NUMERIC_SCALED);
+
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ENUM_STRING", CUBRID_ENUM_STRING);
+	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_ENUM_ORDINAL", CUBRID_ENUM_ORDINAL);
 
     REGISTER_PDO_CLASS_CONST_LONG("TRAN_REP_CLASS_COMMIT_INSTANCE", TRAN_REP_CLASS_COMMIT_INSTANCE);
     REGISTER_PDO_CLASS_CONST_LONG("TRAN_REP_CLASS_REP_INSTANCE", TRAN_REP_CLASS_REP_INSTANCE);
@@ -100,6 +130,11 @@ PHP_MINIT_FUNCTION(pdo_cubrid)
 	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_SCH_CROSS_REFERENCE", CUBRID_SCH_CROSS_REFERENCE);
 	REGISTER_PDO_CLASS_CONST_LONG("CUBRID_SCH_ATTR_WITH_SYNONYM", CUBRID_SCH_ATTR_WITH_SYNONYM);
 
+#if PHP_MAJOR_VERSION >= 7
+	pdo_cubrid_lazy_date_minit(TSRMLS_C);
+	pdo_cubrid_lazy_row_minit(TSRMLS_C);
+#endif
+
 	return php_pdo_register_driver(&pdo_cubrid_driver);
 }
 
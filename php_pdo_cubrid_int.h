@@ -48,6 +48,32 @@ typedef enum
     CUBRID_OBJECT = 4,
 } T_CUBRID_ARRAY_TYPE;
 
+/* DATE */
+typedef enum
+{
+    CUBRID_DATE_STRING = 0,
+    CUBRID_DATE_OBJECT = 1,
+    CUBRID_DATE_LAZY = 2,
+} T_CUBRID_DATE_MODE;
+
+/* NUMERIC */
+typedef enum
+{
+    CUBRID_NUMERIC_STRING = 0,
+    CUBRID_NUMERIC_FLOAT = 1,
+    CUBRID_NUMERIC_SCALED = 2,
+} T_CUBRID_NUMERIC_MODE;
+
+/* ENUM */
+typedef enum
+{
+    CUBRID_ENUM_STRING = 0,
+    CUBRID_ENUM_ORDINAL = 1,
+} T_CUBRID_ENUM_MODE;
+
+/* FETCH SIZE */
+#define CUBRID_FETCH_SIZE_ADAPTIVE		-1
+
 /* SCHEMA */
 #define CUBRID_SCH_TABLE				CCI_SCH_CLASS
 #define CUBRID_SCH_VIEW					CCI_SCH_VCLASS
@@ -92,6 +118,7 @@ typedef enum
 #define CUBRID_ER_INVALID_CONN_STR			-30019
 #define CUBRID_ER_EXEC_TIMEOUT				-30021
 #define CUBRID_ER_INVALID_CURSOR_POS		-30022
+#define CUBRID_ER_VALUE_OUT_OF_RANGE		-30023
 #define CUBRID_ER_END						-31000
 /* CAUTION! Also add the error message string to db_error[] */
 
@@ -121,6 +148,33 @@ typedef struct
 	T_CCI_U_TYPE type;
 } pdo_cubrid_lob;
 
+/* Column description kept across executions of a statement */
+typedef struct
+{
+#if PHP_MAJOR_VERSION >= 7
+	zend_string *name;
+	HashTable *enum_map;	/* ENUM label => shared label string, or ordinal in CUBRID_ENUM_ORDINAL mode */
+	zval enum_labels;		/* ENUM labels in ordinal order, read from the schema on demand */
+	HashTable *dedup_map;	/* value => shared string, PDO_CUBRID_ATTR_DEDUP_STRINGS */
+	zend_long dedup_lookups;
+	zend_long dedup_hits;
+	int dedup_off;			/* too many distinct values in the current result */
+#endif
+	T_CCI_U_TYPE ext_type;
+	long maxlen;
+	long precision;
+	int param_type;
+} pdo_cubrid_col_desc;
+
+/* A prepared CCI request handle kept for reuse, see PDO_CUBRID_ATTR_STMT_CACHE_SIZE */
+typedef struct
+{
+	int stmt_handle;
+	int bind_num;
+	T_CCI_PARAM_INFO *param_info;
+	int persistent;
+} pdo_cubrid_stmt_cache_entry;
+
 typedef struct
 {
     const char *file;
@@ -131,6 +185,9 @@ typedef struct
 
 typedef struct cubrid_stmt pdo_cubrid_stmt;
 
+/* Reads one column of the current row the way cubrid_stmt_get_col_data hands it to PDO */
+typedef int (*pdo_cubrid_col_decoder)(pdo_stmt_t *stmt, int colno, char **ptr, unsigned long *len TSRMLS_DC);
+
 typedef struct
 {
     int conn_handle;
@@ -140,6 +197,18 @@ typedef struct
 	int max_string_len;
 	int auto_commit;
 	int query_timeout;
+	int native_types;
+	int fetch_dates;
+	int fetch_collections;
+	long scroll_buffer_size;
+	int numeric_mode;
+	int bit_binary;
+	int fetch_json;
+	int enum_mode;
+	int dedup_strings;
+	long lob_inline_size;
+	long stmt_cache_size;
+	HashTable *stmt_cache;	/* final SQL text => pdo_cubrid_stmt_cache_entry, least recently used first */
     pdo_cubrid_error_info einfo;
 
 	int stmt_count;
@@ -157,12 +226,49 @@ struct cubrid_stmt
     int col_count;
     long row_count;
 	long cursor_pos;
+	long cursor_row;		/* 1-based row the CCI cursor is on, 0 before the first */
+	long result_seq;		/* changes with every result, lazy rows of older ones are stale */
     int bind_num;
     short *l_bind;
     T_CCI_CUBRID_STMT sql_type;
 	T_CCI_PARAM_INFO *param_info;
     T_CCI_COL_INFO *col_info;
 	pdo_cubrid_lob *lob;
+	char *cache_sql;		/* the SQL the handle goes back to the statement cache under, if enabled */
+	size_t cache_sql_len;
+	int array_bound;		/* parameters were bound as arrays, the handle is not reused */
+
+	int native_types;
+	int fetch_dates;
+	int fetch_collections;
+	int numeric_mode;
+	int bit_binary;
+	int fetch_json;
+	int enum_mode;
+	int dedup_strings;
+	long lob_inline_size;	/* LOBs shorter than this are fetched as strings, 0: always streams */
+
+	int fetch_size;			/* rows per network fetch, 0: CCI default */
+	int cur_fetch_size;		/* fetch size in effect in adaptive mode */
+	int fetch_size_cap;
+	long fetch_mark;		/* last row covered by the current fetch size */
+	long fetch_consumed;	/* rows of that fetch read with PDO_FETCH_ORI_NEXT */
+	int max_rows;
+
+	long scroll_buffer_size;	/* memory ceiling of the client-side scroll buffer, 0: off */
+	int scroll_state;
+	long scroll_row_count;
+	long scroll_row;			/* current row in scroll_rows, -1 before the first */
+	zval *scroll_rows;			/* scroll_row_count * col_count values */
+
+	pdo_cubrid_col_desc *col_desc;
+	int col_desc_count;
+	int col_desc_flags;
+#if PHP_MAJOR_VERSION >= 7
+	zend_long col_long;		/* PDO_PARAM_INT column value handed to PDO */
+	zval col_zval;			/* PDO_PARAM_ZVAL column value handed to PDO */
+	pdo_cubrid_col_decoder *decoders;	/* one per column of the current result, built on first use */
+#endif
 };
 
 extern pdo_driver_t pdo_cubrid_driver;
@@ -174,10 +280,34 @@ extern int _pdo_cubrid_error(pdo_dbh_t *dbh, pdo_stmt_t *stmt, int err_code, T_C
 enum {
 	PDO_CUBRID_ATTR_ISOLATION_LEVEL = PDO_ATTR_DRIVER_SPECIFIC,
 	PDO_CUBRID_ATTR_LOCK_TIMEOUT,
-	PDO_CUBRID_ATTR_MAX_STRING_LENGTH
+	PDO_CUBRID_ATTR_MAX_STRING_LENGTH,
+	PDO_CUBRID_ATTR_NATIVE_TYPES,
+	PDO_CUBRID_ATTR_FETCH_SIZE,
+	PDO_CUBRID_ATTR_MAX_ROWS,
+	PDO_CUBRID_ATTR_FETCH_DATES,
+	PDO_CUBRID_ATTR_FETCH_COLLECTIONS,
+	PDO_CUBRID_ATTR_SCROLL_BUFFER_SIZE,
+	PDO_CUBRID_ATTR_NUMERIC_MODE,
+	PDO_CUBRID_ATTR_BIT_BINARY,
+	PDO_CUBRID_ATTR_FETCH_JSON,
+	PDO_CUBRID_ATTR_ENUM_MODE,
+	PDO_CUBRID_ATTR_DEDUP_STRINGS,
+	PDO_CUBRID_ATTR_LOB_INLINE_SIZE,
+	PDO_CUBRID_ATTR_STMT_CACHE_SIZE
 };
 
 extern struct pdo_stmt_methods cubrid_stmt_methods;
+extern const zend_function_entry cubrid_stmt_driver_methods[];
+
+#if PHP_MAJOR_VERSION >= 7
+extern void pdo_cubrid_lazy_date_minit(TSRMLS_D);
+extern void pdo_cubrid_lazy_row_minit(TSRMLS_D);
+
+extern int pdo_cubrid_stmt_cache_get(pdo_dbh_t *dbh, const char *sql, size_t sql_len, 
+		int *bind_num, T_CCI_PARAM_INFO **param_info);
+extern int pdo_cubrid_stmt_cache_put(pdo_dbh_t *dbh, const char *sql, size_t sql_len, 
+		int stmt_handle, int bind_num, T_CCI_PARAM_INFO *param_info);
+#endif
 
 #endif /* PHP_PDO_CUBRID_INT_H */
 
@@ -0,0 +1,109 @@
+--TEST--
+PDO CUBRID: parameters bound in their own type
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id bigint, price double, flag smallint, created datetime, name varchar(20))");
+
+$stmt = $db->prepare('insert into cubrid_test values (?, ?, ?, ?, ?)');
+$stmt->bindParam(1, $id, PDO::PARAM_INT);
+$stmt->bindParam(2, $price, PDO::PARAM_INT);
+$stmt->bindParam(3, $flag, PDO::PARAM_BOOL);
+$stmt->bindParam(4, $created);
+$stmt->bindParam(5, $name);
+
+$id = 9007199254740993;
+$price = 0.5;
+$flag = true;
+$created = new DateTime('2020-02-29 13:14:15.678');
+$name = 'first';
+var_dump($stmt->execute());
+
+$id = 2;
+$price = 2.5;
+$flag = false;
+$created = new DateTimeImmutable('1999-12-31 23:59:59', new DateTimeZone('UTC'));
+$name = 'second';
+var_dump($stmt->execute());
+
+# bound variables keep their types
+var_dump($id, $price, $flag, get_class($created));
+
+foreach ($db->query('select * from cubrid_test order by id desc')->fetchAll(PDO::FETCH_NUM) as $row) {
+	var_dump($row);
+}
+
+$stmt = $db->prepare('select name from cubrid_test where id = ?');
+$stmt->bindValue(1, 2, PDO::PARAM_INT);
+$stmt->execute();
+var_dump($stmt->fetchColumn());
+
+# a bool bound as a string keeps its string form, as an integer it is sent as 0/1
+$stmt = $db->prepare('insert into cubrid_test (id, name) values (?, ?)');
+$stmt->bindParam(1, $id, PDO::PARAM_INT);
+$stmt->bindParam(2, $name);
+$id = 3;
+$name = false;
+$stmt->execute();
+$id = 4;
+$name = true;
+$stmt->execute();
+$stmt->bindParam(2, $name, PDO::PARAM_INT);
+$id = 5;
+$name = false;
+$stmt->execute();
+var_dump($name);
+var_dump($db->query('select name from cubrid_test where id > 2 order by id')->fetchAll(PDO::FETCH_COLUMN));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+bool(true)
+bool(true)
+int(2)
+float(2.5)
+bool(false)
+string(17) "DateTimeImmutable"
+array(5) {
+  [0]=>
+  string(16) "9007199254740993"
+  [1]=>
+  string(3) "0.5"
+  [2]=>
+  string(1) "1"
+  [3]=>
+  string(23) "2020-02-29 13:14:15.678"
+  [4]=>
+  string(5) "first"
+}
+array(5) {
+  [0]=>
+  string(1) "2"
+  [1]=>
+  string(3) "2.5"
+  [2]=>
+  string(1) "0"
+  [3]=>
+  string(23) "1999-12-31 23:59:59.000"
+  [4]=>
+  string(6) "second"
+}
+string(6) "second"
+bool(false)
+array(3) {
+  [0]=>
+  string(0) ""
+  [1]=>
+  string(1) "1"
+  [2]=>
+  string(1) "0"
+}
@@ -0,0 +1,52 @@
+--TEST--
+PDO CUBRID: binary fetch and bind of BIT VARYING columns
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, a bit varying(256), b set(bit varying(64)))");
+
+$db->setAttribute(PDO::CUBRID_ATTR_BIT_BINARY, true);
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_BIT_BINARY));
+
+$hash = md5('cubrid', true);
+$id = 1;
+$a = $hash;
+$b = array("\x01\x02", "\xff");
+$stmt = $db->prepare("insert into cubrid_test values (?, ?, ?)");
+$stmt->bindParam(1, $id, PDO::PARAM_INT);
+$stmt->bindParam(2, $a, PDO::PARAM_STR, 0, 'VARBIT');
+$stmt->bindParam(3, $b, PDO::PARAM_STR, 0, 'VARBIT');
+$stmt->execute();
+
+$stmt = $db->query('select a from cubrid_test');
+$value = $stmt->fetchColumn();
+var_dump($value === $hash);
+
+$hex = $db->cubrid_bit_encode($value);
+var_dump($hex === strtoupper(bin2hex($hash)));
+var_dump($db->cubrid_bit_decode($hex) === $hash);
+var_dump($db->cubrid_bit_decode('ABC') === "\xab\xc0");
+
+# hex text without the binary mode
+$db->setAttribute(PDO::CUBRID_ATTR_BIT_BINARY, false);
+$stmt = $db->query('select a from cubrid_test');
+var_dump(strtoupper($stmt->fetchColumn()) === $hex);
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+bool(true)
+bool(true)
+bool(true)
+bool(true)
+bool(true)
+bool(true)
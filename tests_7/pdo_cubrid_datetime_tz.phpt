@@ -0,0 +1,52 @@
+--TEST--
+PDO CUBRID: describe and fetch timezone-aware date types
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+date_default_timezone_set('UTC');
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (a datetimetz, b timestamptz, c datetime)");
+$db->exec("insert into cubrid_test values (datetimetz'2012-03-04 05:06:07.089 Asia/Seoul', timestamptz'2012-03-04 05:06:07 +02:00', datetime'2012-03-04 05:06:07.089')");
+
+$stmt = $db->query('select * from cubrid_test');
+for ($i = 0; $i < 3; $i++) {
+	$meta = $stmt->getColumnMeta($i);
+	var_dump($meta['type']);
+}
+
+$db->setAttribute(PDO::CUBRID_ATTR_FETCH_DATES, PDO::CUBRID_DATE_OBJECT);
+$stmt = $db->query('select * from cubrid_test');
+$row = $stmt->fetch(PDO::FETCH_NUM);
+var_dump($row[0]->format('Y-m-d H:i:s.v'), $row[0]->getTimezone()->getName());
+var_dump($row[0]->setTimezone(new DateTimeZone('UTC'))->format('Y-m-d H:i:s.v'));
+var_dump($row[1]->format('Y-m-d H:i:s P'));
+var_dump($row[2]->getTimezone()->getName());
+
+$db->setAttribute(PDO::CUBRID_ATTR_FETCH_DATES, PDO::CUBRID_DATE_LAZY);
+$stmt = $db->query('select a from cubrid_test');
+$value = $stmt->fetchColumn();
+var_dump(get_class($value));
+var_dump($value->format('U') == $row[0]->format('U'));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+string(10) "datetimetz"
+string(11) "timestamptz"
+string(8) "datetime"
+string(23) "2012-03-04 05:06:07.089"
+string(10) "Asia/Seoul"
+string(23) "2012-03-03 20:06:07.089"
+string(25) "2012-03-04 05:06:07 +02:00"
+string(3) "UTC"
+string(17) "PDOCubridLazyDate"
+bool(true)
@@ -0,0 +1,68 @@
+--TEST--
+PDO CUBRID: run many SQL statements in one request
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+
+var_dump($db->cubrid_exec_batch(array(
+	"create table cubrid_test (id int primary key, name varchar(10))",
+	"insert into cubrid_test values (1, 'one'), (2, 'two')",
+	"update cubrid_test set name = 'uno' where id = 1",
+	"delete from cubrid_test where id = 3",
+)));
+
+# a failing statement does not stop the others
+$result = $db->cubrid_exec_batch(array(
+	"insert into cubrid_test values (1, 'dup')",
+	"insert into cubrid_test values (3, 'three')",
+), $errors);
+var_dump($result, array_keys($errors), $errors[0]['code'] < 0, strlen($errors[0]['message']) > 0);
+
+var_dump($db->cubrid_exec_batch(array()));
+
+var_dump($db->query('select * from cubrid_test order by id')->fetchAll(PDO::FETCH_COLUMN, 1));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+array(4) {
+  [0]=>
+  int(0)
+  [1]=>
+  int(2)
+  [2]=>
+  int(1)
+  [3]=>
+  int(0)
+}
+array(2) {
+  [0]=>
+  bool(false)
+  [1]=>
+  int(1)
+}
+array(1) {
+  [0]=>
+  int(0)
+}
+bool(true)
+bool(true)
+array(0) {
+}
+array(3) {
+  [0]=>
+  string(3) "uno"
+  [1]=>
+  string(3) "two"
+  [2]=>
+  string(5) "three"
+}
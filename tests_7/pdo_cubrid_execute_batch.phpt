@@ -0,0 +1,75 @@
+--TEST--
+PDO CUBRID: execute a statement for many rows in one request
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int primary key, name varchar(10), price double, created datetime)");
+
+$stmt = $db->prepare('insert into cubrid_test values (?, ?, ?, ?)');
+var_dump($stmt->cubrid_execute_batch(array(
+	array(1, 'one', 1.5, new DateTime('2022-01-02 03:04:05')),
+	array(2, null, 2, null),
+	array(3, 'three', null, new DateTime('2022-01-03 00:00:00')),
+)));
+var_dump($stmt->rowCount());
+
+# the duplicate key fails alone, the other rows are inserted
+$result = $stmt->cubrid_execute_batch(array(array(4, 'four', 4, null), array(1, 'dup', 0, null)), $errors);
+var_dump($result, array_keys($errors), is_int($errors[1]['code']), $errors[1]['code'] < 0);
+
+$stmt = $db->prepare('update cubrid_test set price = price * 2 where id >= ?');
+var_dump($stmt->cubrid_execute_batch(array(array(3), array(10))));
+
+var_dump($stmt->cubrid_execute_batch(array()));
+var_dump(@$stmt->cubrid_execute_batch(array(array())));
+
+foreach ($db->query('select * from cubrid_test order by id')->fetchAll(PDO::FETCH_NUM) as $row) {
+	echo implode('|', $row), "\n";
+}
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+array(3) {
+  [0]=>
+  int(1)
+  [1]=>
+  int(1)
+  [2]=>
+  int(1)
+}
+int(3)
+array(2) {
+  [0]=>
+  int(1)
+  [1]=>
+  bool(false)
+}
+array(1) {
+  [0]=>
+  int(1)
+}
+bool(true)
+bool(true)
+array(2) {
+  [0]=>
+  int(2)
+  [1]=>
+  int(0)
+}
+array(0) {
+}
+bool(false)
+1|one|1.5|2022-01-02 03:04:05.000
+2||2|
+3|three||2022-01-03 00:00:00.000
+4|four|8|
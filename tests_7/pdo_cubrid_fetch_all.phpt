@@ -0,0 +1,95 @@
+--TEST--
+PDO CUBRID: PDOStatement::cubrid_fetch_all
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, val varchar(10))");
+$db->exec("insert into cubrid_test values (1, 'A')");
+$db->exec("insert into cubrid_test values (2, 'B')");
+$db->exec("insert into cubrid_test values (3, NULL)");
+
+$stmt = $db->query('select id, val from cubrid_test order by id');
+var_dump($stmt->cubrid_fetch_all(PDO::FETCH_ASSOC));
+
+$stmt = $db->query('select id, val from cubrid_test order by id');
+$stmt->fetch();
+var_dump($stmt->cubrid_fetch_all(PDO::FETCH_NUM));
+
+$stmt = $db->query('select val from cubrid_test order by id');
+var_dump($stmt->cubrid_fetch_all(PDO::FETCH_COLUMN));
+
+$stmt = $db->query('select id, val from cubrid_test where id = 1');
+var_dump($stmt->cubrid_fetch_all());
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+array(3) {
+  [0]=>
+  array(2) {
+    ["id"]=>
+    string(1) "1"
+    ["val"]=>
+    string(1) "A"
+  }
+  [1]=>
+  array(2) {
+    ["id"]=>
+    string(1) "2"
+    ["val"]=>
+    string(1) "B"
+  }
+  [2]=>
+  array(2) {
+    ["id"]=>
+    string(1) "3"
+    ["val"]=>
+    NULL
+  }
+}
+array(2) {
+  [0]=>
+  array(2) {
+    [0]=>
+    string(1) "2"
+    [1]=>
+    string(1) "B"
+  }
+  [1]=>
+  array(2) {
+    [0]=>
+    string(1) "3"
+    [1]=>
+    NULL
+  }
+}
+array(3) {
+  [0]=>
+  string(1) "A"
+  [1]=>
+  string(1) "B"
+  [2]=>
+  NULL
+}
+array(1) {
+  [0]=>
+  array(4) {
+    ["id"]=>
+    string(1) "1"
+    [0]=>
+    string(1) "1"
+    ["val"]=>
+    string(1) "A"
+    [1]=>
+    string(1) "A"
+  }
+}
@@ -0,0 +1,59 @@
+--TEST--
+PDO CUBRID: fetch large string columns
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (a int, b string)");
+
+$value = str_repeat('0123456789', 300000);
+$stmt = $db->prepare("insert into cubrid_test values (?, ?)");
+$stmt->execute(array(1, $value));
+$stmt->execute(array(2, ''));
+$stmt->execute(array(3, NULL));
+
+$stmt = $db->query('select b from cubrid_test order by a');
+$rows = $stmt->fetchAll(PDO::FETCH_COLUMN);
+var_dump(strlen($rows[0]), $rows[0] === $value, $rows[1], $rows[2]);
+
+# a plain fetch keeps PDO_PARAM_STR
+$meta = $stmt->getColumnMeta(0);
+var_dump($meta['pdo_type']);
+
+# the scroll buffer hands out the stored strings
+$stmt = $db->prepare('select b from cubrid_test order by a', 
+	array(PDO::ATTR_CURSOR => PDO::CURSOR_SCROLL, PDO::CUBRID_ATTR_SCROLL_BUFFER_SIZE => 16 * 1024 * 1024));
+$stmt->execute();
+$first = $stmt->fetchColumn();
+$stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_LAST);
+$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_FIRST);
+var_dump($first === $value, $row[0] === $value);
+
+$db->setAttribute(PDO::ATTR_ORACLE_NULLS, PDO::NULL_EMPTY_STRING);
+$stmt = $db->query('select b from cubrid_test where a = 2');
+var_dump($stmt->fetchColumn());
+$stmt = $db->prepare('select b from cubrid_test where a = 2', 
+	array(PDO::ATTR_CURSOR => PDO::CURSOR_SCROLL, PDO::CUBRID_ATTR_SCROLL_BUFFER_SIZE => 1024));
+$stmt->execute();
+var_dump($stmt->fetchColumn());
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(3000000)
+bool(true)
+string(0) ""
+NULL
+int(2)
+bool(true)
+bool(true)
+NULL
+NULL
@@ -0,0 +1,63 @@
+--TEST--
+PDO CUBRID: small LOBs fetched as strings
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, doc clob)");
+$db->exec("insert into cubrid_test values (1, char_to_clob('short')), (2, char_to_clob('" . str_repeat('x', 100) . "')), (3, NULL), (4, char_to_clob(''))");
+
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_LOB_INLINE_SIZE));
+var_dump(@$db->setAttribute(PDO::CUBRID_ATTR_LOB_INLINE_SIZE, -1));
+
+$stmt = $db->prepare('select doc from cubrid_test order by id', 
+	array(PDO::CUBRID_ATTR_LOB_INLINE_SIZE => 64));
+var_dump($stmt->getAttribute(PDO::CUBRID_ATTR_LOB_INLINE_SIZE));
+$stmt->execute();
+
+foreach ($stmt->fetchAll(PDO::FETCH_COLUMN) as $doc) {
+	if (is_resource($doc)) {
+		var_dump(strlen(stream_get_contents($doc)));
+	} else {
+		var_dump($doc);
+	}
+}
+
+# off by default: every value is a stream
+$stmt = $db->prepare('select doc from cubrid_test where id = 1');
+$stmt->execute();
+var_dump(is_resource($stmt->fetchColumn()));
+
+$db->setAttribute(PDO::CUBRID_ATTR_LOB_INLINE_SIZE, 4096);
+$stmt = $db->prepare('select doc from cubrid_test where id = 2');
+$stmt->execute();
+var_dump(strlen($stmt->fetchColumn()));
+
+# the threshold applies with ATTR_STRINGIFY_FETCHES too
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, true);
+$stmt = $db->prepare('select doc from cubrid_test where id = 2', 
+	array(PDO::CUBRID_ATTR_LOB_INLINE_SIZE => 64));
+$stmt->execute();
+var_dump(is_resource($stmt->fetchColumn()));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(0)
+bool(false)
+int(64)
+string(5) "short"
+int(100)
+NULL
+string(0) ""
+bool(true)
+int(100)
+bool(true)
@@ -0,0 +1,83 @@
+--TEST--
+PDO CUBRID: statement fetch size and max rows attributes
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (a int)");
+for ($i = 1; $i <= 500; $i++) {
+	$db->exec("insert into cubrid_test values ($i)");
+}
+
+$stmt = $db->prepare('select a from cubrid_test order by a', array(PDO::ATTR_PREFETCH => 50));
+var_dump($stmt->getAttribute(PDO::CUBRID_ATTR_FETCH_SIZE));
+
+var_dump($stmt->setAttribute(PDO::CUBRID_ATTR_FETCH_SIZE, 200));
+var_dump($stmt->getAttribute(PDO::ATTR_PREFETCH));
+$stmt->execute();
+var_dump(count($stmt->fetchAll()));
+
+var_dump($stmt->setAttribute(PDO::CUBRID_ATTR_FETCH_SIZE, PDO::CUBRID_FETCH_SIZE_ADAPTIVE));
+$stmt->execute();
+$sum = 0;
+while ($row = $stmt->fetch(PDO::FETCH_NUM)) {
+	$sum += $row[0];
+}
+var_dump($sum);
+
+# rows skipped by scrolling do not grow the adaptive fetch size
+$stmt = $db->prepare('select a from cubrid_test order by a', 
+	array(PDO::ATTR_CURSOR => PDO::CURSOR_SCROLL, PDO::CUBRID_ATTR_FETCH_SIZE => PDO::CUBRID_FETCH_SIZE_ADAPTIVE));
+$stmt->execute();
+for ($i = 0; $i < 150; $i++) {
+	$row = $stmt->fetch(PDO::FETCH_NUM);
+}
+$rows = array($row[0]);
+$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_ABS, 10);
+$rows[] = $row[0];
+$row = $stmt->fetch(PDO::FETCH_NUM);
+$rows[] = $row[0];
+$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_ABS, 490);
+$rows[] = $row[0];
+$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_PRIOR);
+$rows[] = $row[0];
+while ($row = $stmt->fetch(PDO::FETCH_NUM)) {
+	$rows[] = $row[0];
+}
+echo implode(',', $rows), "\n";
+
+var_dump($stmt->setAttribute(PDO::CUBRID_ATTR_MAX_ROWS, 10));
+var_dump($stmt->getAttribute(PDO::CUBRID_ATTR_MAX_ROWS));
+$stmt->execute();
+var_dump(count($stmt->fetchAll()));
+
+var_dump($stmt->setAttribute(PDO::CUBRID_ATTR_MAX_ROWS, 0));
+$stmt->execute();
+var_dump(count($stmt->fetchAll()));
+
+var_dump(@$stmt->setAttribute(PDO::CUBRID_ATTR_FETCH_SIZE, -5));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(50)
+bool(true)
+int(200)
+int(500)
+bool(true)
+int(125250)
+150,10,11,490,489,490,491,492,493,494,495,496,497,498,499,500
+bool(true)
+int(10)
+int(10)
+bool(true)
+int(500)
+bool(false)
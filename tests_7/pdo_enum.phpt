@@ -95,7 +95,7 @@ array(1) {
     string(6) "enum_c"
   }
 }
-array(16) {
+array(17) {
   ["type"]=>
   string(4) "enum"
   ["name"]=>
@@ -124,6 +124,15 @@ array(16) {
   int(0)
   ["reverse_unique"]=>
   int(0)
+  ["enum_labels"]=>
+  array(3) {
+    [0]=>
+    string(6) "enum_a"
+    [1]=>
+    string(6) "enum_b"
+    [2]=>
+    string(6) "enum_c"
+  }
   ["len"]=>
   int(0)
   ["pdo_type"]=>
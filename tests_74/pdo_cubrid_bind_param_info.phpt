@@ -0,0 +1,60 @@
+--TEST--
+PDO CUBRID: parameters bound as the placeholder type
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, code varchar(10), created datetime, price double)");
+$db->exec("create index i_cubrid_test_code on cubrid_test (code)");
+
+# strings into INT and DATETIME placeholders, an int into a VARCHAR one
+$stmt = $db->prepare('insert into cubrid_test values (?, ?, ?, ?)');
+var_dump($stmt->execute(array('1', 7, '2021-03-04 05:06:07.089', '1.25')));
+var_dump($stmt->execute(array(2, '007', new DateTime('2021-03-05 00:00:00'), 3)));
+
+$stmt = $db->prepare('select id, code, created, price from cubrid_test where code = ? or created = ? order by id');
+$stmt->execute(array(7, '2021-03-05 00:00:00'));
+var_dump($stmt->fetchAll(PDO::FETCH_NUM));
+
+# a value CCI can not convert still reaches the server
+$stmt = $db->prepare('select count(*) from cubrid_test where id = ?');
+var_dump(@$stmt->execute(array('not a number')));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+bool(true)
+bool(true)
+array(2) {
+  [0]=>
+  array(4) {
+    [0]=>
+    string(1) "1"
+    [1]=>
+    string(1) "7"
+    [2]=>
+    string(23) "2021-03-04 05:06:07.089"
+    [3]=>
+    string(4) "1.25"
+  }
+  [1]=>
+  array(4) {
+    [0]=>
+    string(1) "2"
+    [1]=>
+    string(3) "007"
+    [2]=>
+    string(23) "2021-03-05 00:00:00.000"
+    [3]=>
+    string(1) "3"
+  }
+}
+bool(false)
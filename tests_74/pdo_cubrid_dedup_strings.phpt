@@ -0,0 +1,61 @@
+--TEST--
+PDO CUBRID: share repeated string values of low-cardinality columns
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, country varchar(2), name varchar(32))");
+
+$stmt = $db->prepare('insert into cubrid_test values (?, ?, ?)');
+$countries = array('KR', 'US', 'FR', '');
+for ($i = 0; $i < 3000; $i++) {
+	$stmt->execute(array($i, $countries[$i % 4], "name $i"));
+}
+
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_DEDUP_STRINGS));
+
+$stmt = $db->prepare('select id, country, name from cubrid_test order by id', 
+	array(PDO::CUBRID_ATTR_DEDUP_STRINGS => true));
+var_dump($stmt->getAttribute(PDO::CUBRID_ATTR_DEDUP_STRINGS));
+
+for ($run = 0; $run < 2; $run++) {
+	$stmt->execute();
+	$rows = $stmt->fetchAll(PDO::FETCH_NUM);
+
+	$ok = count($rows) == 3000;
+	foreach ($rows as $i => $row) {
+		# the name column has 3000 distinct values and stops being shared on the way
+		$ok = $ok && $row[1] === $countries[$i % 4] && $row[2] === "name $i";
+	}
+	var_dump($ok);
+}
+
+$db->setAttribute(PDO::CUBRID_ATTR_DEDUP_STRINGS, true);
+$stmt = $db->query("select country from cubrid_test where id < 4 order by id");
+var_dump($stmt->fetchAll(PDO::FETCH_COLUMN));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+bool(false)
+bool(true)
+bool(true)
+bool(true)
+array(4) {
+  [0]=>
+  string(2) "KR"
+  [1]=>
+  string(2) "US"
+  [2]=>
+  string(2) "FR"
+  [3]=>
+  string(0) ""
+}
@@ -0,0 +1,82 @@
+--TEST--
+PDO CUBRID: fetch ENUM columns as ordinals or shared labels
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, state enum('new', 'it''s open', 'closed'))");
+$db->exec("insert into cubrid_test values (1, 'closed'), (2, 'new'), (3, 'it''s open'), (4, NULL), (5, 'closed')");
+
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_ENUM_MODE));
+
+$stmt = $db->query('select state from cubrid_test order by id');
+$meta = $stmt->getColumnMeta(0);
+var_dump($meta['enum_labels'], $meta['pdo_type']);
+var_dump($stmt->fetchAll(PDO::FETCH_COLUMN));
+
+# shared strings hand the labels out as zvals
+$stmt = $db->prepare('select state from cubrid_test order by id', 
+	array(PDO::CUBRID_ATTR_DEDUP_STRINGS => true));
+$stmt->execute();
+var_dump(implode(',', $stmt->fetchAll(PDO::FETCH_COLUMN)));
+
+$db->setAttribute(PDO::CUBRID_ATTR_ENUM_MODE, PDO::CUBRID_ENUM_ORDINAL);
+$stmt = $db->query('select state, cast(state as int) from cubrid_test order by id');
+while ($row = $stmt->fetch(PDO::FETCH_NUM)) {
+	var_dump($row[0], $row[0] === (is_null($row[1]) ? null : (int)$row[1]));
+}
+
+# per-statement override
+$stmt = $db->prepare('select state from cubrid_test where id = 1', 
+	array(PDO::CUBRID_ATTR_ENUM_MODE => PDO::CUBRID_ENUM_STRING));
+$stmt->execute();
+var_dump($stmt->fetchColumn());
+
+var_dump(@$db->setAttribute(PDO::CUBRID_ATTR_ENUM_MODE, 5));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(0)
+array(3) {
+  [0]=>
+  string(3) "new"
+  [1]=>
+  string(9) "it's open"
+  [2]=>
+  string(6) "closed"
+}
+int(2)
+array(5) {
+  [0]=>
+  string(6) "closed"
+  [1]=>
+  string(3) "new"
+  [2]=>
+  string(9) "it's open"
+  [3]=>
+  NULL
+  [4]=>
+  string(6) "closed"
+}
+string(28) "closed,new,it's open,,closed"
+int(3)
+bool(true)
+int(1)
+bool(true)
+int(2)
+bool(true)
+NULL
+bool(true)
+int(3)
+bool(true)
+string(6) "closed"
+bool(false)
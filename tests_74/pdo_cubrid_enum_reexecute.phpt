@@ -0,0 +1,41 @@
+--TEST--
+PDO CUBRID: ENUM values after a re-execute with another column layout
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, state enum('new', 'open', 'closed'))");
+$db->exec("insert into cubrid_test values (1, 'closed'), (2, 'new')");
+
+# the precision of tag follows the bound value, so each execute has another column layout
+foreach (array(PDO::CUBRID_ENUM_STRING, PDO::CUBRID_ENUM_ORDINAL) as $mode) {
+	$stmt = $db->prepare("select state, concat(?, '') as tag from cubrid_test order by id",
+		array(PDO::CUBRID_ATTR_ENUM_MODE => $mode, PDO::CUBRID_ATTR_DEDUP_STRINGS => true));
+
+	foreach (array('a', 'a much longer tag') as $tag) {
+		$stmt->execute(array($tag));
+		while ($row = $stmt->fetch(PDO::FETCH_NUM)) {
+			var_dump($row[0]);
+		}
+	}
+}
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+string(6) "closed"
+string(3) "new"
+string(6) "closed"
+string(3) "new"
+int(3)
+int(1)
+int(3)
+int(1)
@@ -0,0 +1,56 @@
+--TEST--
+PDO CUBRID: fetch into bound columns in place
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, name varchar(20), price double)");
+$db->exec("insert into cubrid_test values (1, 'apple', 1.5), (2, NULL, 2.25), (3, 'strawberry', 3)");
+
+$stmt = $db->prepare('select id, name, price from cubrid_test order by id', 
+	array(PDO::CUBRID_ATTR_NATIVE_TYPES => true));
+$stmt->execute();
+$stmt->bindColumn(1, $id, PDO::PARAM_INT);
+$stmt->bindColumn('name', $name);
+$stmt->bindColumn(3, $price, PDO::PARAM_STR);
+
+while ($stmt->cubrid_fetch_bound()) {
+	var_dump($id, $name, $price);
+}
+var_dump($stmt->cubrid_fetch_bound());
+
+# same values as PDO::FETCH_BOUND
+$stmt->execute();
+$expected = array();
+while ($stmt->fetch(PDO::FETCH_BOUND)) {
+	$expected[] = array($id, $name, $price);
+}
+$stmt->execute();
+$got = array();
+while ($stmt->cubrid_fetch_bound()) {
+	$got[] = array($id, $name, $price);
+}
+var_dump($expected === $got);
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(1)
+string(5) "apple"
+string(3) "1.5"
+int(2)
+NULL
+string(4) "2.25"
+int(3)
+string(10) "strawberry"
+string(1) "3"
+bool(false)
+bool(true)
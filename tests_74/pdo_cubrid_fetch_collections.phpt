@@ -0,0 +1,81 @@
+--TEST--
+PDO CUBRID: fetch collection columns as arrays
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (a set(int), b multiset(varchar(10)), c sequence(double))");
+$db->exec("insert into cubrid_test values ({3, 1, 2}, {'x', 'y', 'x'}, {1.5, 2.5})");
+$db->exec("insert into cubrid_test values (NULL, NULL, NULL)");
+
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, false);
+$db->setAttribute(PDO::CUBRID_ATTR_FETCH_COLLECTIONS, true);
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_FETCH_COLLECTIONS));
+
+$stmt = $db->query('select * from cubrid_test order by a desc');
+var_dump($stmt->fetchAll(PDO::FETCH_NUM));
+
+# stringify keeps the elements as strings
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, true);
+$stmt = $db->query('select a from cubrid_test where a is not null');
+var_dump($stmt->fetchColumn());
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+bool(true)
+array(2) {
+  [0]=>
+  array(3) {
+    [0]=>
+    array(3) {
+      [0]=>
+      int(1)
+      [1]=>
+      int(2)
+      [2]=>
+      int(3)
+    }
+    [1]=>
+    array(3) {
+      [0]=>
+      string(1) "x"
+      [1]=>
+      string(1) "x"
+      [2]=>
+      string(1) "y"
+    }
+    [2]=>
+    array(2) {
+      [0]=>
+      float(1.5)
+      [1]=>
+      float(2.5)
+    }
+  }
+  [1]=>
+  array(3) {
+    [0]=>
+    NULL
+    [1]=>
+    NULL
+    [2]=>
+    NULL
+  }
+}
+array(3) {
+  [0]=>
+  string(1) "1"
+  [1]=>
+  string(1) "2"
+  [2]=>
+  string(1) "3"
+}
@@ -0,0 +1,63 @@
+--TEST--
+PDO CUBRID: PDOStatement::cubrid_fetch_columns
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, false);
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, price double, name varchar(10))");
+$db->exec("insert into cubrid_test values (1, 0.5, 'A')");
+$db->exec("insert into cubrid_test values (2, NULL, 'B')");
+$db->exec("insert into cubrid_test values (3, 2.25, NULL)");
+
+$stmt = $db->query('select id, price, name from cubrid_test order by id');
+var_dump($stmt->cubrid_fetch_columns());
+
+$stmt = $db->query('select id from cubrid_test where id > 100');
+var_dump($stmt->cubrid_fetch_columns());
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+array(3) {
+  ["id"]=>
+  array(3) {
+    [0]=>
+    int(1)
+    [1]=>
+    int(2)
+    [2]=>
+    int(3)
+  }
+  ["price"]=>
+  array(3) {
+    [0]=>
+    float(0.5)
+    [1]=>
+    NULL
+    [2]=>
+    float(2.25)
+  }
+  ["name"]=>
+  array(3) {
+    [0]=>
+    string(1) "A"
+    [1]=>
+    string(1) "B"
+    [2]=>
+    NULL
+  }
+}
+array(1) {
+  ["id"]=>
+  array(0) {
+  }
+}
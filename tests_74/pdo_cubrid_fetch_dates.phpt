@@ -0,0 +1,78 @@
+--TEST--
+PDO CUBRID: fetch date and time columns as date objects
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+date_default_timezone_set('UTC');
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (a date, b time, c timestamp, d datetime)");
+$db->exec("insert into cubrid_test values ('2012-03-04', '05:06:07', '2012-03-04 05:06:07', '2012-03-04 05:06:07.089')");
+$db->exec("insert into cubrid_test values (NULL, NULL, NULL, NULL)");
+
+$db->setAttribute(PDO::CUBRID_ATTR_FETCH_DATES, PDO::CUBRID_DATE_OBJECT);
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_FETCH_DATES));
+
+$stmt = $db->query('select * from cubrid_test order by a desc');
+$row = $stmt->fetch(PDO::FETCH_NUM);
+foreach ($row as $value) {
+	var_dump(get_class($value), $value->format('Y-m-d H:i:s.u'));
+}
+var_dump($stmt->fetch(PDO::FETCH_NUM));
+
+$db->setAttribute(PDO::CUBRID_ATTR_FETCH_DATES, PDO::CUBRID_DATE_LAZY);
+$stmt = $db->query('select * from cubrid_test where a is not null');
+$row = $stmt->fetch(PDO::FETCH_NUM);
+foreach ($row as $value) {
+	var_dump(get_class($value), (string)$value);
+}
+var_dump($row[3]->format('Y-m-d H:i:s.u'));
+var_dump(get_class($row[3]->toDateTime()));
+
+# per-statement override
+$stmt = $db->prepare('select a from cubrid_test where a is not null', 
+	array(PDO::CUBRID_ATTR_FETCH_DATES => PDO::CUBRID_DATE_STRING));
+$stmt->execute();
+var_dump($stmt->fetchColumn());
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(1)
+string(17) "DateTimeImmutable"
+string(26) "2012-03-04 00:00:00.000000"
+string(17) "DateTimeImmutable"
+string(26) "1970-01-01 05:06:07.000000"
+string(17) "DateTimeImmutable"
+string(26) "2012-03-04 05:06:07.000000"
+string(17) "DateTimeImmutable"
+string(26) "2012-03-04 05:06:07.089000"
+array(4) {
+  [0]=>
+  NULL
+  [1]=>
+  NULL
+  [2]=>
+  NULL
+  [3]=>
+  NULL
+}
+string(17) "PDOCubridLazyDate"
+string(10) "2012-03-04"
+string(17) "PDOCubridLazyDate"
+string(8) "05:06:07"
+string(17) "PDOCubridLazyDate"
+string(19) "2012-03-04 05:06:07"
+string(17) "PDOCubridLazyDate"
+string(23) "2012-03-04 05:06:07.089"
+string(26) "2012-03-04 05:06:07.089000"
+string(17) "DateTimeImmutable"
+string(10) "2012-03-04"
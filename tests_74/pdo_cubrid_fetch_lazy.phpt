@@ -0,0 +1,69 @@
+--TEST--
+PDO CUBRID: lazy rows decode columns on first read
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, name varchar(20), note varchar(20))");
+$db->exec("insert into cubrid_test values (1, 'one', 'first'), (2, 'two', NULL), (3, 'three', 'third')");
+
+$stmt = $db->query('select * from cubrid_test order by id');
+$rows = array();
+while ($row = $stmt->cubrid_fetch_lazy()) {
+	$rows[] = $row;
+}
+var_dump(get_class($rows[0]), count($rows));
+
+# rows read after the statement moved on still see their own values
+var_dump($rows[0]['name'], $rows[2]->name, $rows[1][0], $rows[0]->id);
+var_dump(isset($rows[1]['note']), isset($rows[0]['note']), isset($rows[0]['missing']));
+var_dump($rows[1]->toArray());
+
+try {
+	$rows[0]['name'] = 'changed';
+} catch (PDOException $e) {
+	echo $e->getMessage(), "\n";
+}
+
+# the statement re-executed, old rows can not be decoded any more
+$stmt->execute();
+var_dump($rows[2]['name']);
+var_dump(@$rows[2]['note']);
+
+# PDO::FETCH_LAZY
+$stmt = $db->query('select * from cubrid_test order by id');
+$row = $stmt->fetch(PDO::FETCH_LAZY);
+var_dump($row->name);
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+string(16) "PDOCubridLazyRow"
+int(3)
+string(3) "one"
+string(5) "three"
+string(1) "2"
+string(1) "1"
+bool(false)
+bool(true)
+bool(false)
+array(3) {
+  ["id"]=>
+  string(1) "2"
+  ["name"]=>
+  string(3) "two"
+  ["note"]=>
+  NULL
+}
+Cannot modify a PDOCubridLazyRow
+string(5) "three"
+bool(false)
+string(3) "one"
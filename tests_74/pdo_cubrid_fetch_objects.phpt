@@ -0,0 +1,86 @@
+--TEST--
+PDO CUBRID: fetch rows into class instances
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+class Fruit
+{
+	public $id;
+	protected $name;
+	private $price = 0;
+	public $built = false;
+
+	public function __construct()
+	{
+		$this->built = $this->id !== null;
+	}
+
+	public function describe()
+	{
+		return $this->id . ':' . $this->name . ':' . $this->price;
+	}
+}
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, name varchar(20), price double, note varchar(10))");
+$db->exec("insert into cubrid_test values (1, 'apple', 1.5, 'red'), (2, 'pear', 2.25, NULL)");
+
+$stmt = $db->prepare('select id, name, price, note from cubrid_test order by id',
+	array(PDO::CUBRID_ATTR_NATIVE_TYPES => true));
+$stmt->execute();
+$rows = $stmt->cubrid_fetch_objects('Fruit');
+
+foreach ($rows as $row) {
+	var_dump(get_class($row), $row->id, $row->describe(), $row->built, $row->note);
+}
+
+# same objects as PDO::FETCH_CLASS
+$stmt->execute();
+$expected = $stmt->fetchAll(PDO::FETCH_CLASS, 'Fruit');
+var_dump($expected == $rows);
+
+$stmt->execute();
+$stmt->fetch();
+var_dump(count($stmt->cubrid_fetch_objects('Fruit')));
+var_dump($stmt->cubrid_fetch_objects('Fruit'));
+
+# typed properties are coerced like a property assignment
+class TypedFruit
+{
+	public string $id;
+	public float $price;
+}
+
+$stmt = $db->prepare('select id, price from cubrid_test order by id',
+	array(PDO::CUBRID_ATTR_NATIVE_TYPES => true));
+$stmt->execute();
+$typed = $stmt->cubrid_fetch_objects('TypedFruit');
+var_dump($typed[0]->id, $typed[1]->price);
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+string(5) "Fruit"
+int(1)
+string(11) "1:apple:1.5"
+bool(true)
+string(3) "red"
+string(5) "Fruit"
+int(2)
+string(11) "2:pear:2.25"
+bool(true)
+NULL
+bool(true)
+int(1)
+array(0) {
+}
+string(1) "1"
+float(2.25)
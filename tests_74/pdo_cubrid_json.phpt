@@ -0,0 +1,52 @@
+--TEST--
+PDO CUBRID: JSON columns
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, a json)");
+$db->exec("insert into cubrid_test values (1, '{\"theme\":\"dark\",\"size\":12,\"tags\":[\"a\",\"b\"]}')");
+$db->exec("insert into cubrid_test values (2, NULL)");
+
+$stmt = $db->query('select a from cubrid_test order by id');
+$meta = $stmt->getColumnMeta(0);
+var_dump($meta['type']);
+var_dump(is_string($stmt->fetchColumn()));
+
+$db->setAttribute(PDO::CUBRID_ATTR_FETCH_JSON, true);
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_FETCH_JSON));
+$stmt = $db->query('select a from cubrid_test order by id');
+var_dump($stmt->fetchAll(PDO::FETCH_COLUMN));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+string(4) "json"
+bool(true)
+bool(true)
+array(2) {
+  [0]=>
+  array(3) {
+    ["theme"]=>
+    string(4) "dark"
+    ["size"]=>
+    int(12)
+    ["tags"]=>
+    array(2) {
+      [0]=>
+      string(1) "a"
+      [1]=>
+      string(1) "b"
+    }
+  }
+  [1]=>
+  NULL
+}
@@ -0,0 +1,75 @@
+--TEST--
+PDO CUBRID: native typed fetch of numeric columns
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (a int, b smallint, c bigint, d double, e varchar(10))");
+$db->exec("insert into cubrid_test values (1, 2, 9223372036854775807, 1.5, 'abc')");
+$db->exec("insert into cubrid_test values (NULL, NULL, NULL, NULL, NULL)");
+
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, false);
+$db->setAttribute(PDO::CUBRID_ATTR_NATIVE_TYPES, true);
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_NATIVE_TYPES));
+
+$stmt = $db->query('select * from cubrid_test order by a desc');
+var_dump($stmt->fetchAll(PDO::FETCH_NUM));
+
+# stringify still wins
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, true);
+$stmt = $db->query('select a, d from cubrid_test where a = 1');
+var_dump($stmt->fetch(PDO::FETCH_NUM));
+
+# per-statement override
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, false);
+$stmt = $db->prepare('select a from cubrid_test where a = 1', array(PDO::CUBRID_ATTR_NATIVE_TYPES => false));
+$stmt->execute();
+var_dump($stmt->fetchColumn());
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+bool(true)
+array(2) {
+  [0]=>
+  array(5) {
+    [0]=>
+    int(1)
+    [1]=>
+    int(2)
+    [2]=>
+    int(9223372036854775807)
+    [3]=>
+    float(1.5)
+    [4]=>
+    string(3) "abc"
+  }
+  [1]=>
+  array(5) {
+    [0]=>
+    NULL
+    [1]=>
+    NULL
+    [2]=>
+    NULL
+    [3]=>
+    NULL
+    [4]=>
+    NULL
+  }
+}
+array(2) {
+  [0]=>
+  string(1) "1"
+  [1]=>
+  string(3) "1.5"
+}
+string(1) "1"
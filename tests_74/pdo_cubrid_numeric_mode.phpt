@@ -0,0 +1,69 @@
+--TEST--
+PDO CUBRID: NUMERIC fetch modes
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, a numeric(10,2), b numeric(38,0))");
+$db->exec("insert into cubrid_test values (1, 12345.67, 1)");
+$db->exec("insert into cubrid_test values (2, -0.05, 99999999999999999999999999999999999999)");
+$db->exec("insert into cubrid_test values (3, NULL, NULL)");
+
+$db->setAttribute(PDO::ATTR_STRINGIFY_FETCHES, false);
+
+$stmt = $db->query('select a from cubrid_test order by id');
+var_dump($stmt->fetchAll(PDO::FETCH_COLUMN));
+
+$db->setAttribute(PDO::CUBRID_ATTR_NUMERIC_MODE, PDO::CUBRID_NUMERIC_SCALED);
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_NUMERIC_MODE));
+$stmt = $db->query('select a from cubrid_test order by id');
+var_dump($stmt->fetchAll(PDO::FETCH_COLUMN));
+
+# does not fit in an integer
+$db->setAttribute(PDO::ATTR_ERRMODE, PDO::ERRMODE_SILENT);
+$stmt = $db->query('select b from cubrid_test where id = 2');
+var_dump($stmt->fetchColumn());
+var_dump($stmt->errorInfo()[1]);
+
+$db->setAttribute(PDO::CUBRID_ATTR_NUMERIC_MODE, PDO::CUBRID_NUMERIC_FLOAT);
+$stmt = $db->query('select a from cubrid_test order by id');
+var_dump($stmt->fetchAll(PDO::FETCH_COLUMN));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+array(3) {
+  [0]=>
+  string(8) "12345.67"
+  [1]=>
+  string(5) "-0.05"
+  [2]=>
+  NULL
+}
+int(2)
+array(3) {
+  [0]=>
+  int(1234567)
+  [1]=>
+  int(-5)
+  [2]=>
+  NULL
+}
+bool(false)
+int(-30023)
+array(3) {
+  [0]=>
+  float(12345.67)
+  [1]=>
+  float(-0.05)
+  [2]=>
+  NULL
+}
@@ -0,0 +1,72 @@
+--TEST--
+PDO CUBRID: client-side buffered scrollable cursor
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (a int, b varchar(10))");
+for ($i = 1; $i <= 5; $i++) {
+	$db->exec("insert into cubrid_test values ($i, 'row$i')");
+}
+
+function scroll($stmt) {
+	$stmt->execute();
+	$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_LAST);
+	echo $row[1], "\n";
+	$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_PRIOR);
+	echo $row[1], "\n";
+	$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_ABS, 2);
+	echo $row[1], "\n";
+	$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_REL, 2);
+	echo $row[1], "\n";
+	$row = $stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_FIRST);
+	echo $row[1], "\n";
+	var_dump($stmt->fetch(PDO::FETCH_NUM, PDO::FETCH_ORI_PRIOR));
+	var_dump(count($stmt->fetchAll()));
+}
+
+$db->setAttribute(PDO::CUBRID_ATTR_SCROLL_BUFFER_SIZE, 1024 * 1024);
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_SCROLL_BUFFER_SIZE));
+
+$stmt = $db->prepare('select * from cubrid_test order by a', 
+	array(PDO::ATTR_CURSOR => PDO::CURSOR_SCROLL));
+scroll($stmt);
+
+# over the ceiling, the CCI cursor is used
+$stmt = $db->prepare('select * from cubrid_test order by a', 
+	array(PDO::ATTR_CURSOR => PDO::CURSOR_SCROLL, PDO::CUBRID_ATTR_SCROLL_BUFFER_SIZE => 16));
+scroll($stmt);
+
+$stmt = $db->prepare('select * from cubrid_test order by a', 
+	array(PDO::ATTR_CURSOR => PDO::CURSOR_SCROLL, PDO::CUBRID_ATTR_SCROLL_BUFFER_SIZE => 16));
+$stmt->execute();
+$row = $stmt->fetch(PDO::FETCH_NUM);
+echo $row[1], "\n";
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(1048576)
+row5
+row4
+row2
+row4
+row1
+bool(false)
+int(4)
+row5
+row4
+row2
+row4
+row1
+bool(false)
+int(4)
+row1
@@ -0,0 +1,91 @@
+--TEST--
+PDO CUBRID: prepared statement cache
+--SKIPIF--
+<?php # vim:ft=php
+if (!extension_loaded('pdo')) die('skip');
+require_once 'pdo_test.inc';
+PDOTest::skip();
+?>
+--FILE--
+<?php
+require_once 'pdo_test.inc';
+$db = PDOTest::factory();
+
+$db->exec("drop table if exists cubrid_test");
+$db->exec("create table cubrid_test (id int, name varchar(10))");
+$db->exec("insert into cubrid_test values (1, 'one'), (2, 'two'), (3, 'three')");
+
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_STMT_CACHE_SIZE));
+var_dump(@$db->setAttribute(PDO::CUBRID_ATTR_STMT_CACHE_SIZE, -1));
+var_dump($db->setAttribute(PDO::CUBRID_ATTR_STMT_CACHE_SIZE, 2));
+var_dump($db->getAttribute(PDO::CUBRID_ATTR_STMT_CACHE_SIZE));
+
+function lookup($db, $id)
+{
+	$stmt = $db->prepare('select name from cubrid_test where id = ?');
+	$stmt->execute(array($id));
+	return $stmt->fetchColumn();
+}
+
+# the second and third prepares take the handle the previous statement returned
+var_dump(lookup($db, 1), lookup($db, 2), lookup($db, 3));
+
+# a statement left with an open cursor still hands back a usable handle
+$stmt = $db->prepare('select id from cubrid_test order by id');
+$stmt->execute();
+var_dump($stmt->fetchColumn());
+unset($stmt);
+$stmt = $db->prepare('select id from cubrid_test order by id');
+$stmt->execute();
+var_dump($stmt->fetchAll(PDO::FETCH_COLUMN));
+
+# two live statements of the same SQL do not share a handle
+$a = $db->prepare('select name from cubrid_test where id = ?');
+$b = $db->prepare('select name from cubrid_test where id = ?');
+$a->execute(array(1));
+$b->execute(array(2));
+var_dump($a->fetchColumn(), $b->fetchColumn());
+unset($a, $b);
+
+# named placeholders share the handle of the same positional SQL
+$stmt = $db->prepare('select name from cubrid_test where id = :id');
+$stmt->execute(array(':id' => 3));
+var_dump($stmt->fetchColumn());
+unset($stmt);
+
+# more SQL texts than the cache holds, and turning it off
+for ($i = 0; $i < 4; $i++) {
+	$stmt = $db->prepare("select count(*) from cubrid_test where id > $i");
+	$stmt->execute();
+	$counts[] = $stmt->fetchColumn();
+}
+unset($stmt);
+var_dump(implode(',', $counts));
+var_dump($db->setAttribute(PDO::CUBRID_ATTR_STMT_CACHE_SIZE, 0));
+var_dump(lookup($db, 2));
+
+$db->exec("drop table cubrid_test");
+?>
+--EXPECT--
+int(0)
+bool(false)
+bool(true)
+int(2)
+string(3) "one"
+string(3) "two"
+string(5) "three"
+string(1) "1"
+array(3) {
+  [0]=>
+  string(1) "1"
+  [1]=>
+  string(1) "2"
+  [2]=>
+  string(1) "3"
+}
+string(3) "one"
+string(3) "two"
+string(5) "three"
+string(7) "3,2,1,0"
+bool(true)
+string(3) "two"